@@ -8,15 +8,20 @@
 #include "Engine/LocalPlayer.h"
 #include "Net/UnrealNetwork.h"
 #include "Utility/ALSXTGameplayTags.h"
+#include "Utility/ALSXTStats.h"
 #include "Utility/ALSXTStructs.h"
 #include "Kismet/KismetSystemLibrary.h"
 #include "Settings/ALSXTCharacterSettings.h"
 #include "Settings/ALSXTVaultingSettings.h"
 #include "Settings/ALSXTCombatSettings.h"
+#include "Notify/ALSXTAnimNotify_FootstepEffects.h"
+#include "Notify/ALSXTAnimNotify_SlideEffects.h"
 #include "GameFramework/PlayerController.h"
 #include "GameFramework/Pawn.h"
 #include "GameFramework/Character.h"
 #include "GameFramework/CharacterMovementComponent.h"
+#include "GameFramework/GameStateBase.h"
+#include "GameFramework/PlayerState.h"
 #include "Interfaces/ALSXTCollisionInterface.h"
 #include "Interfaces/ALSXTCharacterInterface.h"
 //
@@ -28,6 +33,10 @@
 #include "Components/CapsuleComponent.h"
 #include "Kismet/KismetSystemLibrary.h"
 #include "Kismet/GameplayStatics.h"
+#include "Misc/ScopeExit.h"
+
+DECLARE_DWORD_COUNTER_STAT(TEXT("Attack Trace Sweeps"), STAT_ALSXTAttackTraceSweeps, STATGROUP_ALSXT);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Attack Trace Scratch Buffer Growths"), STAT_ALSXTAttackTraceScratchBufferGrowths, STATGROUP_ALSXT);
 
 AALSXTCharacter::AALSXTCharacter()
 {
@@ -57,6 +66,11 @@ void AALSXTCharacter::Tick(const float DeltaTime)
 	Super::Tick(DeltaTime);
 
 	RefreshVaulting();
+
+	if (RewindBuffer.IsInitialized())
+	{
+		RecordRewindSample();
+	}
 }
 
 void AALSXTCharacter::NotifyControllerChanged()
@@ -96,7 +110,7 @@ void AALSXTCharacter::GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutL
 	Parameters.bIsPushBased = true;
 
 	Parameters.Condition = COND_SkipOwner;
-	DOREPLIFETIME_WITH_PARAMS_FAST(ThisClass, FootprintsState, Parameters)
+	DOREPLIFETIME_WITH_PARAMS_FAST(ThisClass, FootprintsNetState, Parameters)
 	DOREPLIFETIME_WITH_PARAMS_FAST(ThisClass, DefensiveModeState, Parameters)
 	DOREPLIFETIME_WITH_PARAMS_FAST(ThisClass, DesiredFreelooking, Parameters)
 	DOREPLIFETIME_WITH_PARAMS_FAST(ThisClass, DesiredSex, Parameters)
@@ -134,7 +148,23 @@ void AALSXTCharacter::BeginPlay()
 	SetDesiredPhysicalAnimationMode(ALSXTPhysicalAnimationModeTags::None, "pelvis");
 	GetMesh()->SetEnablePhysicsBlending(true);
 
-	AttackTraceTimerDelegate.BindUFunction(this, "AttackCollisionTrace", AttackTraceSettings);
+	if (GetNetMode() != NM_DedicatedServer && IsValid(ALSXTSettings))
+	{
+		if (IsValid(ALSXTSettings->FootstepEffects))
+		{
+			ALSXTSettings->FootstepEffects->RequestPreload();
+		}
+
+		if (IsValid(ALSXTSettings->SlideEffects))
+		{
+			ALSXTSettings->SlideEffects->RequestPreload();
+		}
+	}
+
+	if (ShouldRecordRewindSamples())
+	{
+		RewindBuffer.Initialize(ALSXTSettings->Combat.RewindBufferCapacity, ALSXTSettings->Combat.RewindBoneNames);
+	}
 }
 
 void AALSXTCharacter::CalcCamera(const float DeltaTime, FMinimalViewInfo& ViewInfo)
@@ -469,32 +499,71 @@ bool AALSXTCharacter::IsAimingDownSights_Implementation() const
 
 void AALSXTCharacter::SetFootprintsState(const EALSXTFootBone& Foot, const FALSXTFootprintsState& NewFootprintsState)
 {
+	// Simulated proxies only take the replicated state, a local write could hide the next replicated change.
+	if (GetLocalRole() == ROLE_SimulatedProxy)
+	{
+		return;
+	}
+
 	const auto PreviousFootprintsState{ FootprintsState };
 
 	FootprintsState = NewFootprintsState;
 
 	OnFootprintsStateChanged(PreviousFootprintsState);
 
+	// Only the surface types and the quantized amounts are sent, everything else is rebuilt from the footstep effects settings.
+	const auto NewFootprintsNetState{ FALSXTFootprintsNetState::FromFootprintsState(FootprintsState) };
+
+	if (NewFootprintsNetState == FootprintsNetState)
+	{
+		return;
+	}
+
+	FootprintsNetState = NewFootprintsNetState;
+
+	MARK_PROPERTY_DIRTY_FROM_NAME(ThisClass, FootprintsNetState, this)
+
 	if ((GetLocalRole() == ROLE_AutonomousProxy) && IsLocallyControlled())
 	{
-		ServerSetFootprintsState(Foot, NewFootprintsState);
+		ServerSetFootprintsNetState(FootprintsNetState);
 	}
 }
 
-void AALSXTCharacter::ServerSetFootprintsState_Implementation(const EALSXTFootBone& Foot, const FALSXTFootprintsState& NewFootprintsState)
+void AALSXTCharacter::ServerSetFootprintsNetState_Implementation(const FALSXTFootprintsNetState& NewFootprintsNetState)
 {
-	SetFootprintsState(Foot, NewFootprintsState);
+	SetFootprintsNetState(NewFootprintsNetState);
 }
 
-
-void AALSXTCharacter::ServerProcessNewFootprintsState_Implementation(const EALSXTFootBone& Foot, const FALSXTFootprintsState& NewFootprintsState)
+void AALSXTCharacter::SetFootprintsNetState(const FALSXTFootprintsNetState& NewFootprintsNetState)
 {
-	ProcessNewFootprintsState(Foot, NewFootprintsState);
+	if (FootprintsNetState != NewFootprintsNetState)
+	{
+		FootprintsNetState = NewFootprintsNetState;
+
+		MARK_PROPERTY_DIRTY_FROM_NAME(ThisClass, FootprintsNetState, this)
+	}
+
+	const auto PreviousFootprintsState{ FootprintsState };
+
+	const auto* FootstepEffectsSettings{ IsValid(ALSXTSettings) ? ALSXTSettings->FootstepEffects.Get() : nullptr };
+
+	if (ALS_ENSURE_MESSAGE(IsValid(FootstepEffectsSettings),
+	                       TEXT("Footstep effects are not set in the character settings, replicated footprint states are only partially rebuilt.")))
+	{
+		FootstepEffectsSettings->RebuildFootprintsState(FootprintsNetState, FootprintsState);
+	}
+	else
+	{
+		FootprintsNetState.Left.ApplyTo(FootprintsState.Left);
+		FootprintsNetState.Right.ApplyTo(FootprintsState.Right);
+	}
+
+	OnFootprintsStateChanged(PreviousFootprintsState);
 }
 
-void AALSXTCharacter::OnReplicate_FootprintsState(const FALSXTFootprintsState& PreviousFootprintsState)
+void AALSXTCharacter::OnReplicate_FootprintsNetState(const FALSXTFootprintsNetState& PreviousFootprintsNetState)
 {
-	OnFootprintsStateChanged(PreviousFootprintsState);
+	SetFootprintsNetState(FootprintsNetState);
 }
 
 void AALSXTCharacter::OnFootprintsStateChanged_Implementation(const FALSXTFootprintsState& PreviousFootprintsState) {}
@@ -1194,133 +1263,442 @@ void AALSXTCharacter::GetStrengthFromHit(FDoubleHitResult Hit, FGameplayTag& Str
 void AALSXTCharacter::BeginAttackCollisionTrace(FALSXTCombatAttackTraceSettings TraceSettings)
 {
 	AttackTraceSettings = TraceSettings;
-	GetWorld()->GetTimerManager().SetTimer(AttackTraceTimerHandle, AttackTraceTimerDelegate, 0.1f, true);
+
+	bAttackCollisionTraceActive = true;
+	bHasAttackTraceSample = false;
+
+	AttackTraceObjectQueryParameters = FCollisionObjectQueryParams{};
+
+	if (IsValid(ALSXTSettings))
+	{
+		for (const auto ObjectType : ALSXTSettings->Combat.AttackTraceObjectTypes)
+		{
+			AttackTraceObjectQueryParameters.AddObjectTypesToQuery(UEngineTypes::ConvertToCollisionChannel(ObjectType));
+		}
+	}
+
+	AttackTraceQueryParameters = FCollisionQueryParams{SCENE_QUERY_STAT(ALSXTAttackCollisionTrace), false, this};
+
+	// Any growth of the scratch buffers happens here rather than during the trace ticks.
+	AttackTraceHits.Reserve(16);
+	AttackTraceHitActors.Reset();
+	AttackTraceLastHitActors.Reset();
+
+	UpdateAttackCollisionTrace(TraceSettings.Start, TraceSettings.End, TraceSettings.Radius);
 }
 
 void AALSXTCharacter::AttackCollisionTrace()
 {
-		// Update AttackTraceSettings
-		GetUnarmedTraceLocations(AttackTraceSettings.AttackType, AttackTraceSettings.Start, AttackTraceSettings.End, AttackTraceSettings.Radius);
+	UpdateAttackCollisionTrace(AttackTraceSettings.Start, AttackTraceSettings.End, AttackTraceSettings.Radius);
+}
 
-		// Declare Local Vars
-		TArray<AActor*> InitialIgnoredActors;
-		TArray<AActor*> OriginTraceIgnoredActors;
-		TArray<FHitResult> HitResults;
-		InitialIgnoredActors.Add(this);	// Add Self to Initial Trace Ignored Actors
+void AALSXTCharacter::UpdateAttackCollisionTrace(const FVector& Start, const FVector& End, const float Radius)
+{
+	// The owning client traces the attack and the server only validates the hits it reports.
+	if (!bAttackCollisionTraceActive || !IsValid(ALSXTSettings) || IsAttackTracedRemotely())
+	{
+		return;
+	}
+
+	const auto PreviousStart{AttackTraceSettings.Start};
+	const auto PreviousEnd{AttackTraceSettings.End};
+	const auto bHasPreviousSample{bHasAttackTraceSample};
 
-		TArray<TEnumAsByte<EObjectTypeQuery>> AttackTraceObjectTypes;
-		AttackTraceObjectTypes = ALSXTSettings->Combat.AttackTraceObjectTypes;
+	AttackTraceSettings.Start = Start;
+	AttackTraceSettings.End = End;
+	AttackTraceSettings.Radius = Radius;
+	bHasAttackTraceSample = true;
 
-		// Initial Trace
-		bool isHit = UKismetSystemLibrary::SphereTraceMultiForObjects(GetWorld(), AttackTraceSettings.Start, AttackTraceSettings.End, AttackTraceSettings.Radius, ALSXTSettings->Combat.AttackTraceObjectTypes, false, InitialIgnoredActors, EDrawDebugTrace::None, HitResults, true, FLinearColor::Green, FLinearColor::Red, 0.0f);
+	const auto ScratchAllocatedSize{AttackTraceHits.GetAllocatedSize() + AttackTraceHitActors.GetAllocatedSize()};
 
-		if (isHit)
+	ON_SCOPE_EXIT
+	{
+		if (AttackTraceHits.GetAllocatedSize() + AttackTraceHitActors.GetAllocatedSize() != ScratchAllocatedSize)
 		{
-			// Loop through HitResults Array
-			for (auto& HitResult : HitResults)
-			{
-				// Check if not in AttackedActors Array
-				if (!AttackTraceLastHitActors.Contains(HitResult.GetActor()))
-				{
-					// Add to AttackedActors Array
-					AttackTraceLastHitActors.AddUnique(HitResult.GetActor());
-
-					// Declare Local Vars
-					FAttackDoubleHitResult CurrentHitResult;
-					FGameplayTag ImpactLoc;
-					FGameplayTag ImpactSide;
-					FGameplayTag ImpactForm;
-					AActor* HitActor{ nullptr };
-					FString HitActorname;
-					float HitActorVelocity { 0.0f };
-					float HitActorMass { 0.0f };
-					float HitActorAttackVelocity { 0.0f };
-					float HitActorAttackMass { 0.0f };
-					float TotalImpactEnergy { 0.0f };
-
-					// Populate Hit
-					// 
-					
-					// Call OnActorAttackCollision on CollisionInterface
-					if (UKismetSystemLibrary::DoesImplementInterface(HitActor, UALSXTCollisionInterface::StaticClass()))
-					{
-						IALSXTCollisionInterface::Execute_GetActorVelocity(HitActor, HitActorVelocity);
-						IALSXTCollisionInterface::Execute_GetActorMass(HitActor, HitActorMass);
-					}
+			INC_DWORD_STAT(STAT_ALSXTAttackTraceScratchBufferGrowths);
+		}
+	};
 
-					// Get Attack Physics
-					if (UKismetSystemLibrary::DoesImplementInterface(HitActor, UALSXTCharacterInterface::StaticClass()))
-					{
-						IALSXTCharacterInterface::Execute_GetCombatAttackPhysics(HitActor, HitActorAttackMass, HitActorAttackVelocity);
-					}
+	if (!bHasPreviousSample)
+	{
+		// Nothing to sweep from yet, so only the current sample is traced.
+		AttackTraceHits.Reset();
 
-					TotalImpactEnergy = 50 + (HitActorVelocity * HitActorMass) + (HitActorAttackVelocity * HitActorAttackMass);
-					// FMath::Square(TossSpeed)
-
-					FVector HitDirection = HitResult.ImpactPoint - GetActorLocation();
-					HitDirection.Normalize();
-					CurrentHitResult.DoubleHitResult.HitResult.Direction = HitDirection;
-					CurrentHitResult.DoubleHitResult.HitResult.Impulse = HitResult.Normal * TotalImpactEnergy;
-					CurrentHitResult.DoubleHitResult.HitResult.HitResult = HitResult;
-					GetLocationFromBoneName(CurrentHitResult.DoubleHitResult.HitResult.HitResult.BoneName, ImpactLoc);
-					CurrentHitResult.DoubleHitResult.ImpactLocation = ImpactLoc;
-					CurrentHitResult.Type = AttackTraceSettings.AttackType;
-					GetSideFromHit(CurrentHitResult.DoubleHitResult, ImpactSide);
-					CurrentHitResult.DoubleHitResult.ImpactSide = ImpactSide;
-					CurrentHitResult.Strength = AttackTraceSettings.AttackStrength;
-					GetFormFromHit(CurrentHitResult.DoubleHitResult, ImpactForm);
-					HitActor = CurrentHitResult.DoubleHitResult.HitResult.HitResult.GetActor();
-					HitActorname = HitActor->GetName();
-
-					// Setup Origin Trace
-					FHitResult OriginHitResult;
-					OriginTraceIgnoredActors.Add(HitResult.GetActor());	// Add Hit Actor to Origin Trace Ignored Actors
-
-					// Perform Origin Trace
-					bool isOriginHit = UKismetSystemLibrary::SphereTraceSingleForObjects(GetWorld(), HitResult.Location, AttackTraceSettings.Start, AttackTraceSettings.Radius, ALSXTSettings->Combat.AttackTraceObjectTypes, false, OriginTraceIgnoredActors, EDrawDebugTrace::None, OriginHitResult, true, FLinearColor::Green, FLinearColor::Red, 4.0f);
-
-					// Perform Origin Hit Trace to get PhysMat eyc for ImpactLocation
-					if (isOriginHit)
-					{
-						// Populate Origin Hit
-						CurrentHitResult.DoubleHitResult.OriginHitResult.HitResult = OriginHitResult;
-					
-						// Populate Values based if Holding Item
-						if (IsHoldingItem())
-						{
-							GetHeldItemAttackDamageInfo(CurrentHitResult.Type, CurrentHitResult.Strength, CurrentHitResult.BaseDamage, CurrentHitResult.DoubleHitResult.ImpactForm, CurrentHitResult.DoubleHitResult.HitResult.DamageType);
-						}
-						else
-						{
-							GetUnarmedAttackDamageInfo(CurrentHitResult.Type, CurrentHitResult.Strength, CurrentHitResult.BaseDamage, CurrentHitResult.DoubleHitResult.ImpactForm, CurrentHitResult.DoubleHitResult.HitResult.DamageType);
-						}
-						FString OriginHitActorname = OriginHitResult.GetActor()->GetName();
-						
-					}
-					// Call OnActorAttackCollision on CollisionInterface
-					if (UKismetSystemLibrary::DoesImplementInterface(HitActor, UALSXTCollisionInterface::StaticClass()))
-					{
-						// GEngine->AddOnScreenDebugMessage(-1, 15.0f, FColor::Green, HitActorname);
-						IALSXTCollisionInterface::Execute_OnActorAttackCollision(HitActor, CurrentHitResult);
-					}
-					OnAttackHit(CurrentHitResult);
-				}
+		GetWorld()->SweepMultiByObjectType(AttackTraceHits, Start, End, FQuat::Identity, AttackTraceObjectQueryParameters,
+		                                   FCollisionShape::MakeSphere(Radius), AttackTraceQueryParameters);
+
+		INC_DWORD_STAT(STAT_ALSXTAttackTraceSweeps);
+
+		ProcessAttackCollisionHits();
+		return;
+	}
+
+	// A capsule spanning the trace locations is swept from the previous sample to the current one. The capsule
+	// keeps its orientation during a sweep, so fast rotating limbs are split into several shorter sweeps.
+	const auto PreviousDirection{(PreviousEnd - PreviousStart).GetSafeNormal()};
+	const auto Direction{(End - Start).GetSafeNormal()};
+
+	const auto Angle{FMath::RadiansToDegrees(FMath::Acos(FMath::Clamp(PreviousDirection | Direction, -1.0, 1.0)))};
+
+	const auto SubstepCount{
+		FMath::Clamp(FMath::CeilToInt(Angle / FMath::Max(ALSXTSettings->Combat.AttackTraceMaxSubstepAngle, UE_KINDA_SMALL_NUMBER)), 1,
+		             FMath::Max(1, ALSXTSettings->Combat.AttackTraceMaxSubsteps))
+	};
+
+	auto SweepStart{(PreviousStart + PreviousEnd) * 0.5f};
+
+	for (auto i{1}; i <= SubstepCount; i++)
+	{
+		const auto Alpha{static_cast<float>(i) / SubstepCount};
+		const auto SubstepStart{FMath::Lerp(PreviousStart, Start, Alpha)};
+		const auto SubstepEnd{FMath::Lerp(PreviousEnd, End, Alpha)};
+
+		const auto SweepEnd{(SubstepStart + SubstepEnd) * 0.5f};
+		const auto CapsuleHalfHeight{static_cast<float>(FVector::Dist(SubstepStart, SubstepEnd) * 0.5 + Radius)};
+		const auto CapsuleRotation{FRotationMatrix::MakeFromZ(SubstepEnd - SubstepStart).ToQuat()};
+
+		AttackTraceHits.Reset();
+
+		GetWorld()->SweepMultiByObjectType(AttackTraceHits, SweepStart, SweepEnd, CapsuleRotation, AttackTraceObjectQueryParameters,
+		                                   FCollisionShape::MakeCapsule(Radius, CapsuleHalfHeight), AttackTraceQueryParameters);
+
+		INC_DWORD_STAT(STAT_ALSXTAttackTraceSweeps);
+
+		ProcessAttackCollisionHits();
+
+		SweepStart = SweepEnd;
+	}
+}
+
+void AALSXTCharacter::ProcessAttackCollisionHits()
+{
+	// Loop through HitResults Array
+	for (const auto& HitResult : AttackTraceHits)
+	{
+		// Each actor is hit at most once per trace session
+		auto bAlreadyHit{false};
+		AttackTraceHitActors.Add(HitResult.GetActor(), &bAlreadyHit);
+
+		if (!bAlreadyHit)
+		{
+			AttackTraceLastHitActors.Add(HitResult.GetActor());
+
+			const auto CurrentHitResult{MakeAttackHitResult(HitResult, AttackTraceSettings.Start, AttackTraceSettings.Radius)};
+			auto* HitActor{HitResult.GetActor()};
+
+			// Call OnActorAttackCollision on CollisionInterface
+			if (UKismetSystemLibrary::DoesImplementInterface(HitActor, UALSXTCollisionInterface::StaticClass()))
+			{
+				IALSXTCollisionInterface::Execute_OnActorAttackCollision(HitActor, CurrentHitResult);
+			}
+			OnAttackHit(CurrentHitResult);
+
+			// The hit above is a local prediction, the server applies it once it has been validated
+			if (GetLocalRole() == ROLE_AutonomousProxy && ALSXTSettings->Combat.bValidateAttackHitsOnServer && IsValid(HitActor))
+			{
+				FALSXTAttackHitClaim Claim;
+				Claim.Victim = HitActor;
+				Claim.TraceStart = AttackTraceSettings.Start;
+				Claim.TraceEnd = AttackTraceSettings.End;
+				Claim.TraceRadius = AttackTraceSettings.Radius;
+				Claim.BoneName = HitResult.BoneName;
+				Claim.Location = HitResult.Location;
+				Claim.Time = GetRenderedPoseServerTime(HitActor);
+
+				ServerConfirmAttackHit(Claim);
 			}
 		}
+	}
+}
+
+void AALSXTCharacter::ServerConfirmAttackHit_Implementation(const FALSXTAttackHitClaim& Claim)
+{
+	// Hits are only accepted while the server plays the attack too.
+	if (!bAttackCollisionTraceActive || !ValidateAttackHit(Claim))
+	{
+		return;
+	}
+
+	// Each actor is hit at most once per trace session, a repeated claim is ignored
+	auto bAlreadyHit{false};
+	AttackTraceHitActors.Add(Claim.Victim.Get(), &bAlreadyHit);
+
+	if (bAlreadyHit)
+	{
+		return;
+	}
+
+	AttackTraceLastHitActors.Add(Claim.Victim.Get());
+
+	// Only the victim and the location of the client's hit are used, everything else comes from the server's attack state.
+	const auto* VictimCharacter{Cast<ACharacter>(Claim.Victim)};
+
+	FHitResult HitResult{
+		Claim.Victim, IsValid(VictimCharacter) && Claim.BoneName != NAME_None ? VictimCharacter->GetMesh() : nullptr,
+		Claim.Location, (Claim.Location - Claim.TraceStart).GetSafeNormal()
+	};
+	HitResult.ImpactPoint = Claim.Location;
+	HitResult.ImpactNormal = HitResult.Normal;
+	HitResult.BoneName = Claim.BoneName;
+	HitResult.TraceStart = Claim.TraceStart;
+	HitResult.TraceEnd = Claim.TraceEnd;
+
+	const auto ServerHitResult{MakeAttackHitResult(HitResult, Claim.TraceStart, Claim.TraceRadius)};
+
+	if (UKismetSystemLibrary::DoesImplementInterface(Claim.Victim, UALSXTCollisionInterface::StaticClass()))
+	{
+		IALSXTCollisionInterface::Execute_OnActorAttackCollision(Claim.Victim, ServerHitResult);
+	}
+
+	OnAttackHit(ServerHitResult);
+}
+
+FAttackDoubleHitResult AALSXTCharacter::MakeAttackHitResult(const FHitResult& HitResult, const FVector& TraceStart, const float TraceRadius)
+{
+	// Declare Local Vars
+	FAttackDoubleHitResult CurrentHitResult;
+	FGameplayTag ImpactLoc;
+	FGameplayTag ImpactSide;
+	FGameplayTag ImpactForm;
+	AActor* HitActor{ nullptr };
+	float HitActorVelocity { 0.0f };
+	float HitActorMass { 0.0f };
+	float HitActorAttackVelocity { 0.0f };
+	float HitActorAttackMass { 0.0f };
+	float TotalImpactEnergy { 0.0f };
+
+	// Populate Hit
+	// 
+	
+	// Call OnActorAttackCollision on CollisionInterface
+	if (UKismetSystemLibrary::DoesImplementInterface(HitActor, UALSXTCollisionInterface::StaticClass()))
+	{
+		IALSXTCollisionInterface::Execute_GetActorVelocity(HitActor, HitActorVelocity);
+		IALSXTCollisionInterface::Execute_GetActorMass(HitActor, HitActorMass);
+	}
+
+	// Get Attack Physics
+	if (UKismetSystemLibrary::DoesImplementInterface(HitActor, UALSXTCharacterInterface::StaticClass()))
+	{
+		IALSXTCharacterInterface::Execute_GetCombatAttackPhysics(HitActor, HitActorAttackMass, HitActorAttackVelocity);
+	}
+
+	TotalImpactEnergy = 50 + (HitActorVelocity * HitActorMass) + (HitActorAttackVelocity * HitActorAttackMass);
+	// FMath::Square(TossSpeed)
+
+	FVector HitDirection = HitResult.ImpactPoint - GetActorLocation();
+	HitDirection.Normalize();
+	CurrentHitResult.DoubleHitResult.HitResult.Direction = HitDirection;
+	CurrentHitResult.DoubleHitResult.HitResult.Impulse = HitResult.Normal * TotalImpactEnergy;
+	CurrentHitResult.DoubleHitResult.HitResult.HitResult = HitResult;
+	GetLocationFromBoneName(CurrentHitResult.DoubleHitResult.HitResult.HitResult.BoneName, ImpactLoc);
+	CurrentHitResult.DoubleHitResult.ImpactLocation = ImpactLoc;
+	CurrentHitResult.Type = AttackTraceSettings.AttackType;
+	GetSideFromHit(CurrentHitResult.DoubleHitResult, ImpactSide);
+	CurrentHitResult.DoubleHitResult.ImpactSide = ImpactSide;
+	CurrentHitResult.Strength = AttackTraceSettings.AttackStrength;
+	GetFormFromHit(CurrentHitResult.DoubleHitResult, ImpactForm);
+	HitActor = CurrentHitResult.DoubleHitResult.HitResult.HitResult.GetActor();
+
+	// Setup Origin Trace. Ignored actors are stored inline, so this does not allocate
+	FHitResult OriginHitResult;
+	FCollisionQueryParams OriginTraceQueryParameters{SCENE_QUERY_STAT(ALSXTAttackOriginTrace), false};
+	OriginTraceQueryParameters.AddIgnoredActor(HitActor);	// Add Hit Actor to Origin Trace Ignored Actors
+
+	// Perform Origin Trace
+	const auto isOriginHit{
+		GetWorld()->SweepSingleByObjectType(OriginHitResult, HitResult.Location, TraceStart, FQuat::Identity,
+		                                    AttackTraceObjectQueryParameters, FCollisionShape::MakeSphere(TraceRadius),
+		                                    OriginTraceQueryParameters)
+	};
+
+	INC_DWORD_STAT(STAT_ALSXTAttackTraceSweeps);
+
+	// Perform Origin Hit Trace to get PhysMat eyc for ImpactLocation
+	if (isOriginHit)
+	{
+		// Populate Origin Hit
+		CurrentHitResult.DoubleHitResult.OriginHitResult.HitResult = OriginHitResult;
+	
+		// Populate Values based if Holding Item
+		if (IsHoldingItem())
+		{
+			GetHeldItemAttackDamageInfo(CurrentHitResult.Type, CurrentHitResult.Strength, CurrentHitResult.BaseDamage, CurrentHitResult.DoubleHitResult.ImpactForm, CurrentHitResult.DoubleHitResult.HitResult.DamageType);
+		}
+		else
+		{
+			GetUnarmedAttackDamageInfo(CurrentHitResult.Type, CurrentHitResult.Strength, CurrentHitResult.BaseDamage, CurrentHitResult.DoubleHitResult.ImpactForm, CurrentHitResult.DoubleHitResult.HitResult.DamageType);
+		}
+	}
+
+	return CurrentHitResult;
+}
+
+bool AALSXTCharacter::ValidateAttackHit(const FALSXTAttackHitClaim& Claim) const
+{
+	if (!IsValid(Claim.Victim) || Claim.Victim == this || !IsValid(ALSXTSettings))
+	{
+		return false;
+	}
+
+	const auto& CombatSettings{ALSXTSettings->Combat};
+	const auto CurrentTime{GetWorld()->GetTimeSeconds()};
+
+	// The claimed time is only an estimate of the client, so it is clamped to the rewind window. Repeated
+	// claims are still rejected, since each victim is hit at most once per attack trace.
+	const auto RewindTime{FMath::Clamp(Claim.Time, CurrentTime - CombatSettings.MaxRewindTime, CurrentTime)};
+
+	FALSXTRewindSample AttackerSample;
+	if (!RewindBuffer.GetSampleAtTime(RewindTime, AttackerSample))
+	{
+		AttackerSample.CapsuleLocation = GetActorLocation();
+	}
+
+	const auto MaxReachSquared{FMath::Square(CombatSettings.MaxAttackReach)};
+
+	if (FVector::DistSquared(AttackerSample.CapsuleLocation, Claim.TraceStart) > MaxReachSquared ||
+	    FVector::DistSquared(AttackerSample.CapsuleLocation, Claim.TraceEnd) > MaxReachSquared ||
+	    FVector::DistSquared(AttackerSample.CapsuleLocation, Claim.Location) >
+	    FMath::Square(CombatSettings.MaxAttackReach + CombatSettings.AttackHitValidationTolerance))
+	{
+		return false;
+	}
+
+	const auto* Victim{Cast<AALSXTCharacter>(Claim.Victim)};
+
+	if (!IsValid(Victim))
+	{
+		// Other actors are not recorded, so their current bounds are the best there is.
+		const auto Bounds{Claim.Victim->GetComponentsBoundingBox().ExpandBy(Claim.TraceRadius + CombatSettings.AttackHitValidationTolerance)};
+
+		return Bounds.IsInside(Claim.Location) &&
+		       (FMath::LineBoxIntersection(Bounds, Claim.TraceStart, Claim.TraceEnd, Claim.TraceEnd - Claim.TraceStart) ||
+			       Bounds.IsInside(Claim.TraceStart));
+	}
+
+	FALSXTRewindSample VictimSample;
+	if (!Victim->GetRewindBuffer().GetSampleAtTime(RewindTime, VictimSample))
+	{
+		const auto* VictimCapsule{Victim->GetCapsuleComponent()};
+
+		VictimSample.CapsuleLocation = VictimCapsule->GetComponentLocation();
+		VictimSample.CapsuleRotation = VictimCapsule->GetComponentQuat();
+		VictimSample.CapsuleRadius = VictimCapsule->GetScaledCapsuleRadius();
+		VictimSample.CapsuleHalfHeight = VictimCapsule->GetScaledCapsuleHalfHeight();
+	}
+
+	// The attack path against the victim's capsule axis.
+	const auto CapsuleAxis{
+		VictimSample.CapsuleRotation.GetUpVector() * FMath::Max(0.0f, VictimSample.CapsuleHalfHeight - VictimSample.CapsuleRadius)
+	};
+
+	FVector TracePoint;
+	FVector CapsulePoint;
+	FMath::SegmentDistToSegmentSafe(Claim.TraceStart, Claim.TraceEnd, VictimSample.CapsuleLocation - CapsuleAxis,
+	                                VictimSample.CapsuleLocation + CapsuleAxis, TracePoint, CapsulePoint);
+
+	const auto MaxCapsuleDistance{VictimSample.CapsuleRadius + Claim.TraceRadius + CombatSettings.AttackHitValidationTolerance};
+
+	if (FVector::DistSquared(TracePoint, CapsulePoint) > FMath::Square(MaxCapsuleDistance))
+	{
+		return false;
+	}
+
+	// The claimed hit location must lie on the victim's capsule at that time too.
+	const auto MaxLocationDistance{VictimSample.CapsuleRadius + CombatSettings.AttackHitValidationTolerance};
+
+	if (FVector::DistSquared(FMath::ClosestPointOnSegment(Claim.Location, VictimSample.CapsuleLocation - CapsuleAxis,
+	                                                      VictimSample.CapsuleLocation + CapsuleAxis), Claim.Location) >
+	    FMath::Square(MaxLocationDistance))
+	{
+		return false;
+	}
+
+	// Bones are only checked when the claimed one is recorded. Dedicated servers may skip
+	// animation of characters nobody sees, so the capsule check above is the primary one.
+	const auto BoneIndex{Victim->GetRewindBuffer().FindBoneIndex(Claim.BoneName)};
+
+	if (BoneIndex != INDEX_NONE)
+	{
+		const auto& BoneLocation{VictimSample.BoneLocations[BoneIndex]};
+		const auto MaxBoneDistance{Claim.TraceRadius + CombatSettings.AttackHitBoneValidationTolerance};
+
+		if (FVector::DistSquared(FMath::ClosestPointOnSegment(BoneLocation, Claim.TraceStart, Claim.TraceEnd), BoneLocation) >
+		    FMath::Square(MaxBoneDistance))
+		{
+			return false;
+		}
+	}
+
+	return true;
+}
+
+bool AALSXTCharacter::IsAttackTracedRemotely() const
+{
+	return GetLocalRole() == ROLE_Authority && GetRemoteRole() == ROLE_AutonomousProxy &&
+	       IsValid(ALSXTSettings) && ALSXTSettings->Combat.bValidateAttackHitsOnServer;
+}
+
+bool AALSXTCharacter::ShouldRecordRewindSamples() const
+{
+	return HasAuthority() && GetNetMode() != NM_Standalone &&
+	       IsValid(ALSXTSettings) && ALSXTSettings->Combat.bValidateAttackHitsOnServer;
+}
+
+void AALSXTCharacter::RecordRewindSample()
+{
+	const auto* Capsule{GetCapsuleComponent()};
+	auto& Sample{RewindBuffer.AddSample(GetWorld()->GetTimeSeconds())};
+
+	Sample.CapsuleLocation = Capsule->GetComponentLocation();
+	Sample.CapsuleRotation = Capsule->GetComponentQuat();
+	Sample.CapsuleRadius = Capsule->GetScaledCapsuleRadius();
+	Sample.CapsuleHalfHeight = Capsule->GetScaledCapsuleHalfHeight();
+
+	for (auto i{0}; i < RewindBuffer.GetNumBones(); i++)
+	{
+		Sample.BoneLocations[i] = GetMesh()->GetSocketLocation(RewindBuffer.GetBoneName(i));
+	}
+}
+
+double AALSXTCharacter::GetServerWorldTime() const
+{
+	const auto* GameState{GetWorld()->GetGameState()};
+
+	return IsValid(GameState) ? GameState->GetServerWorldTimeSeconds() : GetWorld()->GetTimeSeconds();
+}
+
+double AALSXTCharacter::GetRenderedPoseServerTime(const AActor* Victim) const
+{
+	const auto* VictimCharacter{Cast<ACharacter>(Victim)};
+	const auto* VictimMovement{IsValid(VictimCharacter) ? VictimCharacter->GetCharacterMovement() : nullptr};
+
+	// Simulated proxies receive the server time of their last movement update and are smoothed towards it.
+	if (IsValid(VictimMovement) && VictimCharacter->GetLocalRole() == ROLE_SimulatedProxy &&
+	    VictimCharacter->GetReplicatedServerLastTransformUpdateTimeStamp() > 0.0f)
+	{
+		return VictimCharacter->GetReplicatedServerLastTransformUpdateTimeStamp() - VictimMovement->NetworkSimulatedSmoothLocationTime;
+	}
+
+	// Other actors are shown as they were when their state was sent, about half the round trip ago.
+	const auto* State{GetPlayerState()};
+
+	return GetServerWorldTime() - (IsValid(State) ? State->GetPingInMilliseconds() * 0.0005f : 0.0f);
 }
 
 void AALSXTCharacter::EndAttackCollisionTrace()
 {
-	// Clear Attack Trace Timer
-	GetWorld()->GetTimerManager().ClearTimer(AttackTraceTimerHandle);
+	bAttackCollisionTraceActive = false;
+	bHasAttackTraceSample = false;
 
 	// Reset Attack Trace Settings
 	AttackTraceSettings.Start = { 0.0f, 0.0f, 0.0f };
 	AttackTraceSettings.End = { 0.0f, 0.0f, 0.0f };
 	AttackTraceSettings.Radius = { 0.0f };
 
-	// Empty AttackTraceLastHitActors Array
-	AttackTraceLastHitActors.Empty();
+	// Keep the memory of the hit actor set for the next trace session
+	AttackTraceHitActors.Reset();
+	AttackTraceLastHitActors.Reset();
 }
 
 // HoldingBreath
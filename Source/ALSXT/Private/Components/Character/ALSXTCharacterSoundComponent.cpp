@@ -1,12 +1,14 @@
 // MIT
 
 #include "Components/Character/ALSXTCharacterSoundComponent.h"
+#include "GameFramework/PlayerController.h"
 #include "Kismet/GameplayStatics.h"
+#include "Subsystems/ALSXTAudioEmitterSubsystem.h"
 
 // Sets default values for this component's properties
 UALSXTCharacterSoundComponent::UALSXTCharacterSoundComponent()
 {
-	PrimaryComponentTick.bCanEverTick = true;
+	PrimaryComponentTick.bCanEverTick = false;
 	SetIsReplicatedByDefault(true);
 }
 
@@ -18,79 +20,15 @@ void UALSXTCharacterSoundComponent::BeginPlay()
 	AlsCharacter = Cast<AAlsCharacter>(GetOwner());
 }
 
-
-void UALSXTCharacterSoundComponent::TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction)
-{
-	Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
-}
-
-void UALSXTCharacterSoundComponent::StartTimeSinceLastActionSoundTimer(const float Delay)
-{
-	ResetTimeSinceLastActionSoundTimer();
-	TimeSinceLastActionSound = 0.0f;
-	GetWorld()->GetTimerManager().SetTimer(TimeSinceLastActionSoundTimer, this, &UALSXTCharacterSoundComponent::IncrementTimeSinceLastActionSound, Delay, false);
-}
-
-void UALSXTCharacterSoundComponent::IncrementTimeSinceLastActionSound()
-{
-	TimeSinceLastActionSound = TimeSinceLastActionSound + 0.1f;
-	
-	if (TimeSinceLastActionSound >= CurrentActionSoundDelay)
-	{
-		ResetTimeSinceLastActionSoundTimer();
-	}
-}
-
-void UALSXTCharacterSoundComponent::ResetTimeSinceLastActionSoundTimer()
-{
-	GetWorld()->GetTimerManager().ClearTimer(TimeSinceLastActionSoundTimer);
-	CurrentActionSoundDelay = 0.0f;
-}
-
-void UALSXTCharacterSoundComponent::StartTimeSinceLastAttackSoundTimer(const float Delay)
+bool UALSXTCharacterSoundComponent::IsSoundCooldownElapsed(const double LastSoundTime, const float Delay) const
 {
-	ResetTimeSinceLastAttackSoundTimer();
-	TimeSinceLastAttackSound = 0.0f;
-	GetWorld()->GetTimerManager().SetTimer(TimeSinceLastAttackSoundTimer, this, &UALSXTCharacterSoundComponent::IncrementTimeSinceLastAttackSound, Delay, false);
+	return GetWorld()->GetTimeSeconds() - LastSoundTime >= Delay;
 }
 
-void UALSXTCharacterSoundComponent::IncrementTimeSinceLastAttackSound()
+void UALSXTCharacterSoundComponent::StartSoundCooldown(double& LastSoundTime, float& Delay, const FVector2D& DelayRange) const
 {
-	TimeSinceLastAttackSound = TimeSinceLastAttackSound + 0.1f;
-
-	if (TimeSinceLastAttackSound >= CurrentAttackSoundDelay)
-	{
-		ResetTimeSinceLastAttackSoundTimer();
-	}
-}
-
-void UALSXTCharacterSoundComponent::ResetTimeSinceLastAttackSoundTimer()
-{
-	GetWorld()->GetTimerManager().ClearTimer(TimeSinceLastAttackSoundTimer);
-	CurrentAttackSoundDelay = 0.0f;
-}
-
-void UALSXTCharacterSoundComponent::StartTimeSinceLastDamageSoundTimer(const float Delay)
-{
-	ResetTimeSinceLastDamageSoundTimer();
-	TimeSinceLastDamageSound = 0.0f;
-	GetWorld()->GetTimerManager().SetTimer(TimeSinceLastDamageSoundTimer, this, &UALSXTCharacterSoundComponent::IncrementTimeSinceLastDamageSound, Delay, false);
-}
-
-void UALSXTCharacterSoundComponent::IncrementTimeSinceLastDamageSound()
-{
-	TimeSinceLastDamageSound = TimeSinceLastDamageSound + 0.1f;
-
-	if (TimeSinceLastDamageSound >= CurrentDamageSoundDelay)
-	{
-		ResetTimeSinceLastDamageSoundTimer();
-	}
-}
-
-void UALSXTCharacterSoundComponent::ResetTimeSinceLastDamageSoundTimer()
-{
-	GetWorld()->GetTimerManager().ClearTimer(TimeSinceLastDamageSoundTimer);
-	CurrentDamageSoundDelay = 0.0f;
+	LastSoundTime = GetWorld()->GetTimeSeconds();
+	Delay = FMath::RandRange(DelayRange.X, DelayRange.Y);
 }
 
 FGameplayTag UALSXTCharacterSoundComponent::ConvertStaminaToStaminaTag(const float Stamina)
@@ -119,109 +57,95 @@ FGameplayTag UALSXTCharacterSoundComponent::ConvertStaminaToStaminaTag(const flo
 
 FALSXTCharacterActionSound UALSXTCharacterSoundComponent::SelectActionSound(UALSXTCharacterSoundSettings* Settings, const FGameplayTag& Overlay, const FGameplayTag& Strength, const float Stamina)
 {
-	TArray<FALSXTCharacterActionSound> ActionSounds = Settings->ActionSounds;
-	TArray<FALSXTCharacterActionSound> FilteredActionSounds = Settings->ActionSounds;
-	FGameplayTag StaminaTag = ConvertStaminaToStaminaTag(Stamina);
-	TArray<FGameplayTag> TagsArray = {Strength, StaminaTag};
-	FGameplayTagContainer TagsContainer = FGameplayTagContainer::CreateFromArray(TagsArray);
-	FALSXTCharacterActionSound SelectedActionSound;
-
-	// Return is there are no sounds
-	if (ActionSounds.Num() < 1 || !ActionSounds[0].CharacterSound.Sound.Sound)
+	if (!IsValid(Settings))
 	{
-		return SelectedActionSound;
-	}
-	
-	// Filter sounds based on Tag parameters
-	for (auto ActionSound : ActionSounds)
-	{
-		TArray<FGameplayTag> CurrentTagsArray;
-		CurrentTagsArray.Append(ActionSound.Strength);
-		CurrentTagsArray.Append(ActionSound.Stamina);
-		FGameplayTagContainer CurrentTagsContainer = FGameplayTagContainer::CreateFromArray(CurrentTagsArray);
-		
-		if (CurrentTagsContainer.HasAllExact(TagsContainer))
-		{
-			FilteredActionSounds.Add(ActionSound);
-		}
+		return {};
 	}
 
-	// Return if Return is there are no filtered sounds
-	if (FilteredActionSounds.Num() < 1 || !FilteredActionSounds[0].CharacterSound.Sound.Sound)
-	{
-		return SelectedActionSound;
-	}
+	const auto SoundIndex{Settings->GetActionSoundTable().SelectSoundIndex(Strength, ConvertStaminaToStaminaTag(Stamina), LastActionSoundIndex)};
 
-	// If more than one result, avoid duplicates
-	if (FilteredActionSounds.Num() > 1)
+	// The sounds may have been changed at runtime without compiling the table again.
+	if (!Settings->ActionSounds.IsValidIndex(SoundIndex))
 	{
-		// If FilteredActionSounds contains LastCharacterActionSound, remove it from FilteredActionSounds array to avoid duplicates
-		if (FilteredActionSounds.Contains(LastCharacterActionSound))
-		{
-			FilteredActionSounds.Remove(LastCharacterActionSound);
-		}
-
-		//Shuffle Array
-		for (int m = FilteredActionSounds.Max(); m >= 0; --m)
-		{
-			int n = FMath::Rand() % (m + 1);
-			if (m != n) FilteredActionSounds.Swap(m, n);
-		}
-
-		// Select Random Array Entry
-		int RandIndex = rand() % FilteredActionSounds.Max();
-		SelectedActionSound = FilteredActionSounds[RandIndex];
-		return SelectedActionSound;
-	}
-	else
-	{
-		SelectedActionSound = FilteredActionSounds[0];
-		return SelectedActionSound;
+		return {};
 	}
 
-	return SelectedActionSound;
+	LastActionSoundIndex = SoundIndex;
+	return Settings->ActionSounds[SoundIndex];
 }
 
 FALSXTCharacterActionSound UALSXTCharacterSoundComponent::SelectAttackSound(UALSXTCharacterSoundSettings* Settings, const FGameplayTag& Overlay, const FGameplayTag& Strength, const float Stamina)
 {
-	FALSXTCharacterActionSound SelectedAttackSound;
+	if (!IsValid(Settings))
+	{
+		return {};
+	}
 
-	//..
+	const auto SoundIndex{Settings->GetAttackSoundTable().SelectSoundIndex(Strength, ConvertStaminaToStaminaTag(Stamina), LastAttackSoundIndex)};
 
-	return SelectedAttackSound;
+	// The sounds may have been changed at runtime without compiling the table again.
+	if (!Settings->AttackSounds.IsValidIndex(SoundIndex))
+	{
+		return {};
+	}
+
+	LastAttackSoundIndex = SoundIndex;
+	return Settings->AttackSounds[SoundIndex];
 }
 
 FALSXTCharacterDamageSound UALSXTCharacterSoundComponent::SelectDamageSound(UALSXTCharacterSoundSettings* Settings, const FGameplayTag& Overlay, const FGameplayTag& Form, const float Damage)
 {
-	FALSXTCharacterDamageSound SelectedDamageSound;
+	if (!IsValid(Settings))
+	{
+		return {};
+	}
+
+	// There are no damage amount tags yet, so any damage entry matches.
+	const auto SoundIndex{Settings->GetDamageSoundTable().SelectSoundIndex(Form, FGameplayTag::EmptyTag, LastDamageSoundIndex)};
 
-	//..
+	// The sounds may have been changed at runtime without compiling the table again.
+	if (!Settings->DamageSounds.IsValidIndex(SoundIndex))
+	{
+		return {};
+	}
 
-	return SelectedDamageSound;
+	LastDamageSoundIndex = SoundIndex;
+	return Settings->DamageSounds[SoundIndex];
 }
 
 FALSXTCharacterDamageSound UALSXTCharacterSoundComponent::SelectDeathSound(UALSXTCharacterSoundSettings* Settings, const FGameplayTag& Overlay, const FGameplayTag& Form, const float Damage)
 {
-	FALSXTCharacterDamageSound SelectedDeathSound;
+	if (!IsValid(Settings))
+	{
+		return {};
+	}
+
+	// There are no damage amount tags yet, so any damage entry matches.
+	const auto SoundIndex{Settings->GetDeathSoundTable().SelectSoundIndex(Form, FGameplayTag::EmptyTag, LastDeathSoundIndex)};
 
-	//..
+	// The sounds may have been changed at runtime without compiling the table again.
+	if (!Settings->DeathSounds.IsValidIndex(SoundIndex))
+	{
+		return {};
+	}
 
-	return SelectedDeathSound;
+	LastDeathSoundIndex = SoundIndex;
+	return Settings->DeathSounds[SoundIndex];
 }
 
 bool UALSXTCharacterSoundComponent::ShouldPlayActionSound(const FGameplayTag& Strength, const float Stamina)
 {
-		return (TimeSinceLastActionSound >= CurrentActionSoundDelay);
+	return IsSoundCooldownElapsed(LastActionSoundTime, CurrentActionSoundDelay);
 }
 
 bool UALSXTCharacterSoundComponent::ShouldPlayAttackSound(const FGameplayTag& AttackMethod, const FGameplayTag& Strength, const float Stamina)
 {
-	return true;
+	return IsSoundCooldownElapsed(LastAttackSoundTime, CurrentAttackSoundDelay);
 }
 
 bool UALSXTCharacterSoundComponent::ShouldPlayDamageSound(const FGameplayTag& AttackMethod, const FGameplayTag& Strength, const FGameplayTag& AttackForm, const float Damage)
 {
-	return true;
+	return IsSoundCooldownElapsed(LastDamageSoundTime, CurrentDamageSoundDelay);
 }
 
 void UALSXTCharacterSoundComponent::PlayActionSound(const FGameplayTag& Overlay, const FGameplayTag& Strength, const float Stamina)
@@ -231,8 +155,7 @@ void UALSXTCharacterSoundComponent::PlayActionSound(const FGameplayTag& Overlay,
 		return;
 	}
 
-	float Delay = FMath::RandRange(ActionSoundDelay.X, ActionSoundDelay.Y);
-	StartTimeSinceLastActionSoundTimer(Delay);
+	StartSoundCooldown(LastActionSoundTime, CurrentActionSoundDelay, ActionSoundDelay);
 	UALSXTCharacterSoundSettings* Settings = SelectCharacterSoundSettings();
 	FALSXTCharacterActionSound Sound = SelectActionSound(Settings, Overlay, Strength, Stamina);
 
@@ -241,33 +164,66 @@ void UALSXTCharacterSoundComponent::PlayActionSound(const FGameplayTag& Overlay,
 		return;
 	}
 
-	if (Character->GetLocalRole() >= ROLE_Authority)
+	// A valid sound is always the last selected one.
+	PlaySoundEvent(Settings, EALSXTCharacterSoundType::Action, LastActionSoundIndex);
+}
+
+void UALSXTCharacterSoundComponent::PlayAttackSound(const FGameplayTag& Overlay, const FGameplayTag& Strength, const FGameplayTag& AttackMode, const float Stamina)
+{
+	if (!CanPlayAttackSound() || !ShouldPlayAttackSound(AttackMode, Strength, Stamina))
 	{
-		MulticastPlaySound(Sound.CharacterSound);
+		return;
 	}
-	else
+
+	StartSoundCooldown(LastAttackSoundTime, CurrentAttackSoundDelay, AttackSoundDelay);
+	UALSXTCharacterSoundSettings* Settings = SelectCharacterSoundSettings();
+	FALSXTCharacterActionSound Sound = SelectAttackSound(Settings, Overlay, Strength, Stamina);
+
+	if (!IsValid(Sound.CharacterSound.Sound.Sound))
 	{
-		ServerPlaySound(Sound.CharacterSound);
+		return;
 	}
+
+	PlaySoundEvent(Settings, EALSXTCharacterSoundType::Attack, LastAttackSoundIndex);
 }
 
-void UALSXTCharacterSoundComponent::PlayAttackSound(const FGameplayTag& Overlay, const FGameplayTag& Strength, const FGameplayTag& AttackMode, const float Stamina) {}
+void UALSXTCharacterSoundComponent::PlayDamageSound(const FGameplayTag& Strength, const FGameplayTag& AttackForm, const float Damage)
+{
+	if (!CanPlayDamageSound() || !ShouldPlayDamageSound(FGameplayTag::EmptyTag, Strength, AttackForm, Damage))
+	{
+		return;
+	}
+
+	StartSoundCooldown(LastDamageSoundTime, CurrentDamageSoundDelay, DamageSoundDelay);
+	UALSXTCharacterSoundSettings* Settings = SelectCharacterSoundSettings();
+	FALSXTCharacterDamageSound Sound = SelectDamageSound(Settings, Character->GetOverlayMode(), AttackForm, Damage);
+
+	if (!IsValid(Sound.CharacterSound.Sound.Sound))
+	{
+		return;
+	}
 
-void UALSXTCharacterSoundComponent::PlayDamageSound(const FGameplayTag& Strength, const FGameplayTag& AttackForm, const float Damage) {}
+	PlaySoundEvent(Settings, EALSXTCharacterSoundType::Damage, LastDamageSoundIndex);
+}
 
 void UALSXTCharacterSoundComponent::PlayDeathSound(const FGameplayTag& Strength, const FGameplayTag& AttackForm, const float Damage) {}
 
-void UALSXTCharacterSoundComponent::PlaySound(FALSXTCharacterSound Sound)
+void UALSXTCharacterSoundComponent::PlaySound(const FALSXTCharacterSound& Sound)
 {
 	if (Sound.Sound.Sound)
 	{
 		UAudioComponent* AudioComponent{ nullptr };
 		FVector SocketLocation = Character->GetMesh()->GetSocketLocation(VoiceSocketName);
 		FRotator PlayerRotation = Character->GetControlRotation();
+		auto* AudioPool{GetWorld()->GetSubsystem<UALSXTAudioEmitterSubsystem>()};
 		if (GetWorld()->WorldType == EWorldType::EditorPreview)
 		{
 			UGameplayStatics::PlaySoundAtLocation(GetWorld(), Sound.Sound.Sound, SocketLocation, 1.0f, 1.0f);
 		}
+		else if (IsValid(AudioPool))
+		{
+			AudioComponent = AudioPool->PlaySoundAtLocation(EALSXTAudioEmitterCategory::Vocal, Sound.Sound.Sound, SocketLocation, PlayerRotation);
+		}
 		else
 		{
 			AudioComponent = UGameplayStatics::SpawnSoundAtLocation(GetWorld(), Sound.Sound.Sound, SocketLocation, PlayerRotation, 1.0f, 1.0f);
@@ -275,12 +231,131 @@ void UALSXTCharacterSoundComponent::PlaySound(FALSXTCharacterSound Sound)
 	}
 }
 
-void UALSXTCharacterSoundComponent::ServerPlaySound_Implementation(FALSXTCharacterSound Sound) 
+void UALSXTCharacterSoundComponent::PlaySoundEvent(UALSXTCharacterSoundSettings* Settings, const EALSXTCharacterSoundType Type,
+                                                   const int32 SoundIndex)
 {
-	MulticastPlaySound(Sound);
+	FALSXTCharacterSoundEvent Event;
+	Event.Settings = Settings;
+	Event.Type = Type;
+	Event.SoundIndex = static_cast<uint16>(SoundIndex);
+
+	if (Character->GetLocalRole() >= ROLE_Authority)
+	{
+		BroadcastSoundEvent(Event);
+	}
+	else
+	{
+		ServerPlaySoundEvent(Event);
+	}
 }
 
-void UALSXTCharacterSoundComponent::MulticastPlaySound_Implementation(FALSXTCharacterSound Sound)
+void UALSXTCharacterSoundComponent::BroadcastSoundEvent(FALSXTCharacterSoundEvent Event)
 {
-	PlaySound(Sound);
-}
\ No newline at end of file
+	SoundEventSequence += 1;
+	Event.Sequence = SoundEventSequence;
+
+	const auto AudibleDistanceSquared{FMath::Square(AudibleDistance)};
+	const auto SoundLocation{Character->GetActorLocation()};
+
+	// Each player within audible distance gets the event through the sound component of its own pawn, since
+	// client calls only reach the owning connection. Players that cannot hear the sound are sent nothing.
+	for (auto Iterator{GetWorld()->GetPlayerControllerIterator()}; Iterator; ++Iterator)
+	{
+		const auto* PlayerController{Iterator->Get()};
+
+		if (!IsValid(PlayerController))
+		{
+			continue;
+		}
+
+		FVector ViewLocation;
+		FRotator ViewRotation;
+		PlayerController->GetPlayerViewPoint(ViewLocation, ViewRotation);
+
+		if (FVector::DistSquared(ViewLocation, SoundLocation) > AudibleDistanceSquared)
+		{
+			continue;
+		}
+
+		if (PlayerController->IsLocalController())
+		{
+			ReceiveSoundEvent(Event);
+			continue;
+		}
+
+		const auto* ListenerPawn{PlayerController->GetPawn()};
+		auto* ListenerSound{IsValid(ListenerPawn) ? ListenerPawn->FindComponentByClass<UALSXTCharacterSoundComponent>() : nullptr};
+
+		if (IsValid(ListenerSound))
+		{
+			ListenerSound->ClientPlaySoundEvent(this, Event);
+		}
+	}
+}
+
+bool UALSXTCharacterSoundComponent::IsAudibleLocally(const FVector& Location) const
+{
+	const auto AudibleDistanceSquared{FMath::Square(AudibleDistance)};
+
+	for (auto Iterator{GetWorld()->GetPlayerControllerIterator()}; Iterator; ++Iterator)
+	{
+		const auto* PlayerController{Iterator->Get()};
+
+		if (!IsValid(PlayerController) || !PlayerController->IsLocalController())
+		{
+			continue;
+		}
+
+		FVector ViewLocation;
+		FRotator ViewRotation;
+		PlayerController->GetPlayerViewPoint(ViewLocation, ViewRotation);
+
+		if (FVector::DistSquared(ViewLocation, Location) <= AudibleDistanceSquared)
+		{
+			return true;
+		}
+	}
+
+	return false;
+}
+
+void UALSXTCharacterSoundComponent::ServerPlaySoundEvent_Implementation(const FALSXTCharacterSoundEvent Event)
+{
+	if (IsValid(Event.Settings) && Event.Settings->FindSound(Event.Type, Event.SoundIndex) != nullptr)
+	{
+		BroadcastSoundEvent(Event);
+	}
+}
+
+void UALSXTCharacterSoundComponent::ClientPlaySoundEvent_Implementation(UALSXTCharacterSoundComponent* Source, const FALSXTCharacterSoundEvent Event)
+{
+	// The source character may not be relevant to this client anymore.
+	if (IsValid(Source))
+	{
+		Source->ReceiveSoundEvent(Event);
+	}
+}
+
+void UALSXTCharacterSoundComponent::ReceiveSoundEvent(const FALSXTCharacterSoundEvent& Event)
+{
+	if (bReceivedSoundEvent && static_cast<int8>(Event.Sequence - LastReceivedSoundSequence) <= 0)
+	{
+		return;
+	}
+
+	bReceivedSoundEvent = true;
+	LastReceivedSoundSequence = Event.Sequence;
+
+	if (!IsAudibleLocally(Character->GetActorLocation()))
+	{
+		return;
+	}
+
+	// Settings that are not loaded on this machine arrive as null and the sound is skipped.
+	const auto* Sound{IsValid(Event.Settings) ? Event.Settings->FindSound(Event.Type, Event.SoundIndex) : nullptr};
+
+	if (Sound != nullptr)
+	{
+		PlaySound(*Sound);
+	}
+}
@@ -1,6 +1,7 @@
 // MIT
 
 #include "Components/Character/ALSXTCombatComponent.h"
+#include "Animation/AnimInstance.h"
 #include "Kismet/GameplayStatics.h"
 #include "Engine/World.h"
 #include "Utility/AlsUtility.h"
@@ -13,18 +14,15 @@
 #include "Math/Vector.h"
 #include "GameFramework/Character.h"
 #include "ALSXTCharacter.h"
-#include "Interfaces/ALSXTTargetLockInterface.h"
+#include "Subsystems/ALSXTTargetRegistrySubsystem.h"
 #include "Interfaces/ALSXTCombatInterface.h"
 
 // Sets default values for this component's properties
 UALSXTCombatComponent::UALSXTCombatComponent()
 {
-	// Set this component to be initialized when the game starts, and to be ticked every frame.  You can turn these features
-	// off to improve performance if you don't need them.
 	PrimaryComponentTick.bCanEverTick = true;
+	PrimaryComponentTick.bStartWithTickEnabled = false;
 	SetIsReplicatedByDefault(true);
-
-	// ...
 }
 
 
@@ -51,6 +49,7 @@ void UALSXTCombatComponent::TickComponent(float DeltaTime, ELevelTick TickType,
 {
 	Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
 	RefreshAttack(DeltaTime);
+	RefreshTargetRotation(DeltaTime);
 }
 
 float UALSXTCombatComponent::GetAngle(FVector Target)
@@ -106,74 +105,112 @@ void UALSXTCombatComponent::TryTraceForTargets()
 	TArray<FGameplayTag> TargetableOverlayModes;
 	GetTargetableOverlayModes(TargetableOverlayModes);
 
-	if (Character && TargetableOverlayModes.Contains(Character->GetOverlayMode()) && Character->IsDesiredAiming() && IsValid(CurrentTarget.HitResult.GetActor()))
+	const auto* TargetActor{CurrentTarget.HitResult.GetActor()};
+
+	if (!Character || !TargetableOverlayModes.Contains(Character->GetOverlayMode()) || !Character->IsDesiredAiming() || !IsValid(TargetActor))
 	{
-		if (Character->GetDistanceTo(CurrentTarget.HitResult.GetActor()) < CombatSettings.MaxInitialLockDistance)
-		{			
-			if (CombatSettings.UnlockWhenTargetIsObstructed) {
-				if (CombatSettings.UnlockWhenTargetIsObstructed && !IsTartgetObstructed()) {
-					if (CurrentTarget.Valid)
-					{
-						RotatePlayerToTarget(CurrentTarget);
-					}
-				}
-				else
-				{
-					DisengageAllTargets();
-					OnTargetObstructed();
-				}
-			}
-			else
-			{
-				if (CurrentTarget.Valid)
-				{
-					RotatePlayerToTarget(CurrentTarget);
-				}
-			}			
-		}
-		else
-		{
-			DisengageAllTargets();
-		}
+		return;
+	}
+
+	if (Character->GetDistanceTo(TargetActor) >= CombatSettings.MaxInitialLockDistance)
+	{
+		DisengageAllTargets();
+		return;
+	}
+
+	// The player is turned towards the target in RefreshTargetRotation()
+	if (CombatSettings.UnlockWhenTargetIsObstructed && ShouldRecheckTargetObstruction(TargetActor) && IsTartgetObstructed())
+	{
+		DisengageAllTargets();
+		OnTargetObstructed();
 	}
 }
 
 void UALSXTCombatComponent::TraceForTargets(TArray<FTargetHitResultEntry>& Targets)
 {
-	FRotator ControlRotation = Character->GetControlRotation();
-	FVector CharLoc = Character->GetActorLocation();
-	FVector ForwardVector = Character->GetActorForwardVector();
-	FVector CameraLocation = Character->Camera->GetFirstPersonCameraLocation();
-	FVector StartLocation = ForwardVector * 150 + CameraLocation;
-	FVector EndLocation = ForwardVector * 200 + StartLocation;
-	// FVector CenterLocation = (StartLocation - EndLocation) / 2 + StartLocation;
-	FVector CenterLocation = (StartLocation - EndLocation) / 8 + StartLocation;
-	// FVector CenterLocation = (StartLocation - EndLocation) / 8;
-	FCollisionShape CollisionShape = FCollisionShape::MakeBox(CombatSettings.TraceAreaHalfSize);
-	TArray<FHitResult> OutHits;
+	auto* TargetRegistry{GetWorld()->GetSubsystem<UALSXTTargetRegistrySubsystem>()};
+
+	if (!IsValid(TargetRegistry))
+	{
+		return;
+	}
+
+	const auto ControlRotation{Character->GetControlRotation().Quaternion()};
+	const auto CharacterLocation{Character->GetActorLocation()};
+	const auto ForwardVector{Character->GetActorForwardVector()};
+	const auto StartLocation{ForwardVector * 150 + Character->Camera->GetFirstPersonCameraLocation()};
+	const auto EndLocation{ForwardVector * 200 + StartLocation};
 
 	// Display Debug Shape
 	if (CombatSettings.DebugMode)
 	{
-		DrawDebugBox(GetWorld(), CenterLocation, CombatSettings.TraceAreaHalfSize, ControlRotation.Quaternion(), FColor::Yellow, false, CombatSettings.DebugDuration, 100, 2);
+		DrawDebugBox(GetWorld(), StartLocation, CombatSettings.TraceAreaHalfSize, ControlRotation, FColor::Yellow, false, CombatSettings.DebugDuration, 100, 2);
+		DrawDebugBox(GetWorld(), EndLocation, CombatSettings.TraceAreaHalfSize, ControlRotation, FColor::Yellow, false, CombatSettings.DebugDuration, 100, 2);
 	}
 
-	bool isHit = GetWorld()->SweepMultiByChannel(OutHits, StartLocation, EndLocation, ControlRotation.Quaternion(), ECollisionChannel::ECC_Camera, CollisionShape);
+	TargetQueryActors.Reset();
+	TargetQueryLocations.Reset();
+	TargetRegistry->QueryTargets(CharacterLocation, CombatSettings.MaxLockDistance, TargetQueryActors, TargetQueryLocations);
 
-	if (isHit)
+	// The trace area is the box swept from the start to the end location, in control rotation space.
+	const auto SweepDelta{ControlRotation.UnrotateVector(EndLocation - StartLocation)};
+	const auto& AreaHalfSize{CombatSettings.TraceAreaHalfSize};
+
+	auto ViewDirection{ControlRotation.GetForwardVector()};
+	ViewDirection.Z = 0.0;
+	ViewDirection.Normalize();
+
+	for (auto i{0}; i < TargetQueryActors.Num(); i++)
 	{
-		for (auto& Hit : OutHits)
+		auto* TargetActor{TargetQueryActors[i]};
+		const auto& TargetLocation{TargetQueryLocations[i]};
+
+		if (TargetActor == Character)
+		{
+			continue;
+		}
+
+		// Find the part of the sweep during which the box contains the target on every axis.
+		const auto LocalLocation{ControlRotation.UnrotateVector(TargetLocation - StartLocation)};
+		auto MinSweepAlpha{0.0};
+		auto MaxSweepAlpha{1.0};
+
+		for (auto Axis{0}; Axis < 3 && MinSweepAlpha <= MaxSweepAlpha; Axis++)
 		{
-			if (Hit.GetActor()->GetClass()->ImplementsInterface(UALSXTTargetLockInterface::StaticClass()) && Hit.GetActor() != Character && Character->GetDistanceTo(Hit.GetActor()) < CombatSettings.MaxLockDistance)
+			const auto Min{LocalLocation[Axis] - AreaHalfSize[Axis]};
+			const auto Max{LocalLocation[Axis] + AreaHalfSize[Axis]};
+
+			if (FMath::IsNearlyZero(SweepDelta[Axis]))
 			{
-				FTargetHitResultEntry HitResultEntry;
-				HitResultEntry.Valid = true;
-				HitResultEntry.DistanceFromPlayer = FVector::Distance(Character->GetActorLocation(), Hit.Location);
-				HitResultEntry.AngleFromCenter = GetAngle(Hit.Location);
-				HitResultEntry.HitResult = Hit;
-				Targets.Add(HitResultEntry);
+				if (Min > 0.0 || Max < 0.0)
+				{
+					MaxSweepAlpha = -1.0;
+				}
+			}
+			else
+			{
+				const auto AlphaA{Min / SweepDelta[Axis]};
+				const auto AlphaB{Max / SweepDelta[Axis]};
+
+				MinSweepAlpha = FMath::Max(MinSweepAlpha, FMath::Min(AlphaA, AlphaB));
+				MaxSweepAlpha = FMath::Min(MaxSweepAlpha, FMath::Max(AlphaA, AlphaB));
 			}
 		}
+
+		if (MinSweepAlpha > MaxSweepAlpha)
+		{
+			continue;
+		}
+
+		// Signed yaw angle from the view direction, positive to the right.
+		const auto TargetDirection{(TargetLocation - CharacterLocation).GetSafeNormal2D()};
+
+		FTargetHitResultEntry HitResultEntry;
+		HitResultEntry.Valid = true;
+		HitResultEntry.DistanceFromPlayer = FVector::Distance(CharacterLocation, TargetLocation);
+		HitResultEntry.AngleFromCenter = FMath::RadiansToDegrees(FMath::Atan2((ViewDirection ^ TargetDirection).Z, ViewDirection | TargetDirection));
+		HitResultEntry.HitResult = FHitResult{TargetActor, Cast<UPrimitiveComponent>(TargetActor->GetRootComponent()), TargetLocation, -TargetDirection};
+		Targets.Add(HitResultEntry);
 	}
 }
 
@@ -204,18 +241,19 @@ void UALSXTCombatComponent::GetClosestTarget()
 					}
 					else
 					{
-						if (Hit.AngleFromCenter < FoundHit.AngleFromCenter)
+						// The angle is signed, the target closest to the center is the one with the smallest absolute angle.
+						if (FMath::Abs(Hit.AngleFromCenter) < FMath::Abs(FoundHit.AngleFromCenter))
 						{
 							FoundHit = Hit;
 						}
 					}
-					GetWorld()->GetTimerManager().SetTimer(TargetTraceTimerHandle, TargetTraceTimerDelegate, 0.001f, true);
 				}
 			}
 		}
 		if (FoundHit.Valid && FoundHit.HitResult.GetActor())
 		{
 			SetCurrentTarget(FoundHit);
+			StartTargetTracking();
 			if (GEngine && CombatSettings.DebugMode)
 			{
 				FString DebugMsg = FString::SanitizeFloat(FoundHit.AngleFromCenter);
@@ -231,25 +269,8 @@ void UALSXTCombatComponent::SetCurrentTarget(const FTargetHitResultEntry& NewTar
 {
 	ClearCurrentTarget();
 	CurrentTarget = NewTarget;
-	USkeletalMeshComponent* HitMesh;
-	AALSXTCharacter* ALSXTChar = Cast<AALSXTCharacter>(CurrentTarget.HitResult.GetActor());
-
-	if (ALSXTChar)
-	{
-		HitMesh = ALSXTChar->GetMesh();
-		TArray<UMaterialInterface*> CharMaterials = HitMesh->GetMaterials();
-
-		if (CharMaterials[0])
-		{
-			for (int m = 0; m < CharMaterials.Num(); m++)
-			{
-				UMaterialInstanceDynamic* CharDynMaterial = HitMesh->CreateAndSetMaterialInstanceDynamic(m);
-				CharDynMaterial->SetScalarParameterValue(CombatSettings.HighlightMaterialParameterName, 1.0f);
-				HitMesh->SetMaterial(m, CharDynMaterial);
-				TargetDynamicMaterials.Add(CharDynMaterial);
-			}
-		}
-	}	
+	bHasTargetObstructionCheck = false;
+	SetTargetHighlighted(CurrentTarget.HitResult.GetActor(), true);
 }
 
 void UALSXTCombatComponent::ClearCurrentTarget()
@@ -260,39 +281,29 @@ void UALSXTCombatComponent::ClearCurrentTarget()
 		CurrentTarget.DistanceFromPlayer = 340282346638528859811704183484516925440.0f;
 		CurrentTarget.AngleFromCenter = 361.0f;
 
-		if (Cast<AALSXTCharacter>(CurrentTarget.HitResult.GetActor()))
-		{
-			USkeletalMeshComponent* HitMesh = Cast<AALSXTCharacter>(CurrentTarget.HitResult.GetActor())->GetMesh();
-			TArray<UMaterialInterface*> CharMaterials = HitMesh->GetMaterials();
-			if (TargetDynamicMaterials[0])
-			{
-				for (int m = 0; m < TargetDynamicMaterials.Num(); m++)
-				{
-					TargetDynamicMaterials[m]->SetScalarParameterValue(CombatSettings.HighlightMaterialParameterName, 0.0f);
-					// HitMesh->SetMaterial(m, CharDynMaterial);
-				}
-				TargetDynamicMaterials.Empty();
-			}
-			// if (CharMaterials[0])
-			// {
-			// 	for (int m = 0; m < CharMaterials.Num(); m++)
-			// 	{
-			// 		UMaterialInstanceDynamic* CharDynMaterial = HitMesh->CreateAndSetMaterialInstanceDynamic(m);
-			// 		CharDynMaterial->SetScalarParameterValue(CombatSettings.HighlightMaterialParameterName, 0.0f);
-			// 		HitMesh->SetMaterial(m, CharDynMaterial);
-			// 	}
-			// }
-		}
+		SetTargetHighlighted(CurrentTarget.HitResult.GetActor(), false);
 		CurrentTarget.HitResult = FHitResult(ForceInit);
 	}
 }
 
+void UALSXTCombatComponent::SetTargetHighlighted(const AActor* TargetActor, const bool bHighlighted) const
+{
+	const auto* ALSXTChar{Cast<AALSXTCharacter>(TargetActor)};
+
+	if (IsValid(ALSXTChar))
+	{
+		// A single scalar in the primitive's scene data, the materials and their draw call batching stay untouched.
+		ALSXTChar->GetMesh()->SetCustomPrimitiveDataFloat(CombatSettings.HighlightCustomPrimitiveDataIndex, bHighlighted ? 1.0f : 0.0f);
+	}
+}
+
 void UALSXTCombatComponent::DisengageAllTargets()
 {
 	ClearCurrentTarget();
 
 	// Clear Trace Timer
 	GetWorld()->GetTimerManager().ClearTimer(TargetTraceTimerHandle);
+	RefreshTickEnabled();
 }
 
 void UALSXTCombatComponent::GetTargetLeft()
@@ -307,7 +318,8 @@ void UALSXTCombatComponent::GetTargetLeft()
 	{
 		for (auto& Hit : OutHits)
 		{
-			if (Hit.HitResult.GetActor() != CurrentTarget.HitResult.GetActor() && (Hit.AngleFromCenter < CurrentTarget.AngleFromCenter))
+			if (Hit.HitResult.GetActor() != CurrentTarget.HitResult.GetActor() &&
+			    (!CurrentTarget.Valid || Hit.AngleFromCenter < CurrentTarget.AngleFromCenter))
 			{
 				if (!FoundHit.Valid)
 				{
@@ -315,7 +327,10 @@ void UALSXTCombatComponent::GetTargetLeft()
 				}
 				else
 				{
-					if (Hit.AngleFromCenter > FoundHit.AngleFromCenter)
+					// Without a current target, start from the target closest to the center.
+					if (CurrentTarget.Valid
+						    ? Hit.AngleFromCenter > FoundHit.AngleFromCenter
+						    : FMath::Abs(Hit.AngleFromCenter) < FMath::Abs(FoundHit.AngleFromCenter))
 					{
 						FoundHit = Hit;
 					}
@@ -338,7 +353,8 @@ void UALSXTCombatComponent::GetTargetRight()
 	{
 		for (auto& Hit : OutHits)
 		{
-			if (Hit.HitResult.GetActor() != CurrentTarget.HitResult.GetActor() && (Hit.AngleFromCenter > CurrentTarget.AngleFromCenter))
+			if (Hit.HitResult.GetActor() != CurrentTarget.HitResult.GetActor() &&
+			    (!CurrentTarget.Valid || Hit.AngleFromCenter > CurrentTarget.AngleFromCenter))
 			{
 				if (!FoundHit.Valid)
 				{
@@ -346,7 +362,10 @@ void UALSXTCombatComponent::GetTargetRight()
 				}
 				else
 				{
-					if (Hit.AngleFromCenter < FoundHit.AngleFromCenter)
+					// Without a current target, start from the target closest to the center.
+					if (CurrentTarget.Valid
+						    ? Hit.AngleFromCenter < FoundHit.AngleFromCenter
+						    : FMath::Abs(Hit.AngleFromCenter) < FMath::Abs(FoundHit.AngleFromCenter))
 					{
 						FoundHit = Hit;
 					}
@@ -376,6 +395,82 @@ void UALSXTCombatComponent::RotatePlayerToTarget(FTargetHitResultEntry Target)
 	}
 }
 
+void UALSXTCombatComponent::StartTargetTracking()
+{
+	bHasTargetObstructionCheck = false;
+	TargetTrackingOverlayMode = Character->GetOverlayMode();
+
+	GetWorld()->GetTimerManager().SetTimer(TargetTraceTimerHandle, TargetTraceTimerDelegate,
+	                                       FMath::Max(0.01f, CombatSettings.TargetTrackingInterval), true);
+	RefreshTickEnabled();
+}
+
+bool UALSXTCombatComponent::IsTargetTracking() const
+{
+	return GetWorld()->GetTimerManager().IsTimerActive(TargetTraceTimerHandle);
+}
+
+bool UALSXTCombatComponent::ShouldRecheckTargetObstruction(const AActor* TargetActor)
+{
+	const auto CharacterLocation{Character->GetActorLocation()};
+	const auto TargetLocation{TargetActor->GetActorLocation()};
+	const auto RecheckDistanceSquared{FMath::Square(CombatSettings.TargetObstructionRecheckDistance)};
+
+	if (bHasTargetObstructionCheck &&
+	    FVector::DistSquared(CharacterLocation, LastObstructionCheckLocation) < RecheckDistanceSquared &&
+	    FVector::DistSquared(TargetLocation, LastObstructionCheckTargetLocation) < RecheckDistanceSquared)
+	{
+		return false;
+	}
+
+	LastObstructionCheckLocation = CharacterLocation;
+	LastObstructionCheckTargetLocation = TargetLocation;
+	bHasTargetObstructionCheck = true;
+
+	return true;
+}
+
+void UALSXTCombatComponent::RefreshTargetRotation(const float DeltaTime)
+{
+	if (!CurrentTarget.Valid || !IsValid(Character) || !IsTargetTracking())
+	{
+		return;
+	}
+
+	// Tracking only starts while aiming in a targetable overlay mode, so leaving either ends it.
+	if (!Character->IsDesiredAiming() || Character->GetOverlayMode() != TargetTrackingOverlayMode)
+	{
+		DisengageAllTargets();
+		return;
+	}
+
+	auto* Controller{Character->GetController()};
+	const auto* TargetActor{CurrentTarget.HitResult.GetActor()};
+
+	if (!IsValid(Controller) || !IsValid(TargetActor))
+	{
+		return;
+	}
+
+	const auto CurrentPlayerRotation{Character->GetActorRotation()};
+	const auto CurrentControlRotation{Controller->GetControlRotation()};
+
+	auto NewControlRotation{UKismetMathLibrary::FindLookAtRotation(Character->GetActorLocation(), TargetActor->GetActorLocation())};
+	NewControlRotation.Pitch = CurrentPlayerRotation.Pitch;
+	NewControlRotation.Roll = CurrentPlayerRotation.Roll;
+
+	if (CombatSettings.TargetRotationInterpolationSpeed > 0.0f)
+	{
+		NewControlRotation = FMath::RInterpTo(CurrentControlRotation, NewControlRotation, DeltaTime,
+		                                      CombatSettings.TargetRotationInterpolationSpeed);
+	}
+
+	if (!NewControlRotation.Equals(CurrentControlRotation))
+	{
+		Controller->SetControlRotation(NewControlRotation);
+	}
+}
+
 // Attack
 
 AActor* UALSXTCombatComponent::TraceForPotentialAttackTarget(float Distance)
@@ -562,61 +657,30 @@ void UALSXTCombatComponent::DetermineAttackMethod_Implementation(FGameplayTag& A
 
 UAnimMontage* UALSXTCombatComponent::SelectAttackMontage_Implementation(const FGameplayTag& AttackType, const FGameplayTag& Stance, const FGameplayTag& Strength, const float BaseDamage)
 {
-	UAnimMontage* SelectedMontage{ nullptr };
-	FActionMontageInfo LastAnimation{ nullptr };
+	const auto* Settings{SelectAttackSettings()};
 
-	UALSXTCombatSettings* Settings = SelectAttackSettings();
+	if (!IsValid(Settings))
+	{
+		return nullptr;
+	}
 
-	for (int i = 0; i < Settings->AttackTypes.Num(); ++i)
-		{
-			if (Settings->AttackTypes[i].AttackType == AttackType)
-			{
-				FAttackType FoundAttackType = Settings->AttackTypes[i];
-				for (int j = 0; j < FoundAttackType.AttackStrengths.Num(); ++j)
-				{
-					if (FoundAttackType.AttackStrengths[j].AttackStrength == Strength)
-					{
-						FAttackStrength FoundAttackStrength = Settings->AttackTypes[i].AttackStrengths[j];
-						for (int k = 0; k < FoundAttackStrength.AttackStances.Num(); ++k)
-						{
-							if (FoundAttackStrength.AttackStances[k].AttackStance == Stance)
-							{
-								FAttackStance FoundAttackStance = Settings->AttackTypes[i].AttackStrengths[j].AttackStances[k];
-								// Declare Local Copy of Montages Array
-								TArray<FActionMontageInfo> MontageArray{ FoundAttackStance.MontageInfo };
-
-								if (MontageArray.Num() > 1)
-								{
-									// If LastAnimation exists, remove it from Local Montages array to avoid duplicates
-									if (LastAnimation.Montage)
-									{
-										MontageArray.Remove(LastAnimation);
-									}
-
-									//Shuffle Array
-									for (int m = MontageArray.Max(); m >= 0; --m)
-									{
-										int n = FMath::Rand() % (m + 1);
-										if (m != n) MontageArray.Swap(m, n);
-									}
-
-									// Select Random Array Entry
-									int RandIndex = rand() % MontageArray.Max();
-									SelectedMontage = MontageArray[RandIndex].Montage;
-									return SelectedMontage;
-								}
-								else
-								{
-									SelectedMontage = MontageArray[0].Montage;
-									return SelectedMontage;
-								}
-							}
-						}
-					}
-				}	
-			}
-		}
-	return SelectedMontage;
+	// The last index is only meaningful in the table of the settings it was selected from.
+	if (LastAttackMontageSettings != Settings)
+	{
+		LastAttackMontageSettings = Settings;
+		LastAttackMontageIndex = INDEX_NONE;
+	}
+
+	const auto MontageIndex{Settings->SelectAttackMontageIndex(AttackType, Strength, Stance, LastAttackMontageIndex)};
+	const auto* MontageInfo{Settings->GetAttackMontage(MontageIndex)};
+
+	if (MontageInfo == nullptr)
+	{
+		return nullptr;
+	}
+
+	LastAttackMontageIndex = MontageIndex;
+	return MontageInfo->Montage;
 }
 
 void UALSXTCombatComponent::GetSyncedAttackMontageInfo_Implementation(FSyncedActionMontageInfo& SyncedActionMontageInfo, const FGameplayTag& AttackType, int32 Index)
@@ -644,7 +708,9 @@ void UALSXTCombatComponent::StartAttackImplementation(UAnimMontage* Montage, con
 	const float StartYawAngle, const float TargetYawAngle)
 {
 	
-	if (IsAttackAllowedToStart(Montage) && Character->GetMesh()->GetAnimInstance()->Montage_Play(Montage, PlayRate))
+	auto* AnimInstance{Character->GetMesh()->GetAnimInstance()};
+
+	if (IsAttackAllowedToStart(Montage) && AnimInstance->Montage_Play(Montage, PlayRate))
 	{
 		CombatState.TargetYawAngle = TargetYawAngle;
 
@@ -652,17 +718,77 @@ void UALSXTCombatComponent::StartAttackImplementation(UAnimMontage* Montage, con
 
 		AlsCharacter->SetLocomotionAction(AlsLocomotionActionTags::PrimaryAction);
 		// Crouch(); //Hack
+
+		AttackSerial += 1;
+
+		FOnMontageBlendingOutStarted BlendingOutDelegate;
+		BlendingOutDelegate.BindUObject(this, &ThisClass::OnAttackMontageBlendingOut, AttackSerial);
+		AnimInstance->Montage_SetBlendingOutDelegate(BlendingOutDelegate, Montage);
+
+		FOnMontageEnded EndedDelegate;
+		EndedDelegate.BindUObject(this, &ThisClass::OnAttackMontageEnded, AttackSerial);
+		AnimInstance->Montage_SetEndDelegate(EndedDelegate, Montage);
+
+		SetAttackPhase(EALSXTAttackPhase::Attacking);
+	}
+}
+
+void UALSXTCombatComponent::RefreshTickEnabled()
+{
+	SetComponentTickEnabled(CombatState.AttackPhase != EALSXTAttackPhase::None || IsTargetTracking());
+}
+
+void UALSXTCombatComponent::SetAttackPhase(const EALSXTAttackPhase NewPhase)
+{
+	if (CombatState.AttackPhase == NewPhase)
+	{
+		return;
+	}
+
+	CombatState.AttackPhase = NewPhase;
+
+	if (NewPhase == EALSXTAttackPhase::None)
+	{
+		StopAttack();
+
+		if (Character->GetLocalRole() >= ROLE_Authority)
+		{
+			Character->ForceNetUpdate();
+		}
+	}
+
+	RefreshTickEnabled();
+}
+
+void UALSXTCombatComponent::OnAttackMontageBlendingOut(UAnimMontage* Montage, const bool bInterrupted, const uint32 Serial)
+{
+	if (Serial == AttackSerial && CombatState.AttackPhase == EALSXTAttackPhase::Attacking)
+	{
+		SetAttackPhase(EALSXTAttackPhase::Recovering);
+	}
+}
+
+void UALSXTCombatComponent::OnAttackMontageEnded(UAnimMontage* Montage, const bool bInterrupted, const uint32 Serial)
+{
+	if (Serial == AttackSerial)
+	{
+		SetAttackPhase(EALSXTAttackPhase::None);
 	}
 }
 
 void UALSXTCombatComponent::RefreshAttack(const float DeltaTime)
 {
+	if (CombatState.AttackPhase == EALSXTAttackPhase::None)
+	{
+		return;
+	}
+
+	// Other actions may take over the character before the attack montage has ended.
 	if (Character->GetLocomotionAction() != AlsLocomotionActionTags::PrimaryAction)
 	{
-		StopAttack();
-		Character->ForceNetUpdate();
+		SetAttackPhase(EALSXTAttackPhase::None);
 	}
-	else
+	else if (CombatState.AttackPhase == EALSXTAttackPhase::Attacking)
 	{
 		RefreshAttackPhysics(DeltaTime);
 	}
@@ -672,8 +798,7 @@ void UALSXTCombatComponent::RefreshAttackPhysics(const float DeltaTime)
 {
 	// float Offset = CombatSettings->Combat.RotationOffset;
 	auto ComponentRotation{ Character->GetCharacterMovement()->UpdatedComponent->GetComponentRotation() };
-	APlayerController* PlayerController = GetWorld()->GetFirstPlayerController();
-	auto TargetRotation{ PlayerController->GetControlRotation() };
+	auto TargetRotation{ Character->GetControlRotation() };
 	// TargetRotation.Yaw = TargetRotation.Yaw + Offset;
 	// TargetRotation.Yaw = TargetRotation.Yaw;
 	// TargetRotation.Pitch = ComponentRotation.Pitch;
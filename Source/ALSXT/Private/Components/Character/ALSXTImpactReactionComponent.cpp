@@ -6,17 +6,19 @@
 #include "Kismet/GameplayStatics.h"
 #include "Math/RandomStream.h"
 #include "Settings/ALSXTAttackReactionSettings.h"
+#include "Subsystems/ALSXTAudioEmitterSubsystem.h"
+#include "Subsystems/ALSXTImpactEffectPoolSubsystem.h"
+#include "DrawDebugHelpers.h"
+#include "Engine/CollisionProfile.h"
+#include "Utility/AlsConstants.h"
 #include "Utility/AlsMacros.h"
+#include "Utility/AlsUtility.h"
 
 // Sets default values for this component's properties
 UALSXTImpactReactionComponent::UALSXTImpactReactionComponent()
 {
-	// Set this component to be initialized when the game starts, and to be ticked every frame.  You can turn these features
-	// off to improve performance if you don't need them.
-	PrimaryComponentTick.bCanEverTick = true;
+	PrimaryComponentTick.bCanEverTick = false;
 	SetIsReplicatedByDefault(true);
-
-	// ...
 }
 
 
@@ -27,71 +29,166 @@ void UALSXTImpactReactionComponent::BeginPlay()
 
 	Character = Cast<AALSXTCharacter>(GetOwner());
 	AlsCharacter = Cast<AAlsCharacter>(GetOwner());
-	
-}
 
+	ReactionRandomStream.GenerateNewSeed();
 
-// Called every frame
-void UALSXTImpactReactionComponent::TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction)
-{
-	Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
-	if (Character->GetVelocity().Length() > 0)
+	// The role is checked when a bump is detected, since it may not be final yet at this point.
+	if (!IsValid(Character) || ImpactReactionSettings.BumpDetectionMode == EALSXTBumpDetectionMode::Disabled)
 	{
-		ObstacleTrace();
+		return;
+	}
+
+	Character->GetCapsuleComponent()->OnComponentHit.AddDynamic(this, &ThisClass::OnCapsuleHit);
+
+	if (ImpactReactionSettings.BumpDetectionMode == EALSXTBumpDetectionMode::MovementHitsAndProbe)
+	{
+		GetWorld()->GetTimerManager().SetTimer(BumpProbeTimerHandle, this, &ThisClass::ObstacleTrace,
+		                                       ImpactReactionSettings.BumpProbeInterval, true);
 	}
-	// ...
 }
 
 void UALSXTImpactReactionComponent::ObstacleTrace()
 {
-	const auto* Capsule{ Character->GetCapsuleComponent() };
+	if (!CanDetectBumps())
+	{
+		return;
+	}
 
-	const auto CapsuleScale{ Capsule->GetComponentScale().Z };
-	// const auto CapsuleRadius{ Capsule->GetScaledCapsuleRadius() };
-	const auto CapsuleRadius{ 30.0f };
-	const auto CapsuleHalfHeight{ Capsule->GetScaledCapsuleHalfHeight() };
+	const auto Velocity{Character->GetVelocity()};
+	const auto Speed{UE_REAL_TO_FLOAT(Velocity.Size2D())};
 
-	// Set Local Variables
-	//const FVector LandingStartLocation{	TargetCapsuleLocation + (DepthTraceHit.Normal * 60) + (DownwardTraceHit.Normal * -(CapsuleHalfHeight * 1)) };
-	const FVector UpVector{ Character->GetActorUpVector() };
-	// const FVector StartLocation{ Character->GetActorLocation() + (UpVector * CapsuleHalfHeight/2) + (Character->GetActorForwardVector() * 5)};
-	const FVector StartLocation{ Character->GetActorLocation() + (UpVector * CapsuleHalfHeight / 2)};
-	
-	//LocomotionState.InputYawAngle
-	TArray<FHitResult> HitResults;
-	TArray<AActor*> IgnoreActors;
-	float TraceDistance {0.0f};
+	if (Speed < ImpactReactionSettings.MinBumpSpeed || ImpactReactionSettings.BumpTraceObjectTypes.Num() <= 0 ||
+	    !Character->GetCharacterMovement()->IsMovingOnGround())
+	{
+		return;
+	}
 
-	if (Character->GetVelocity().Length() > 0)
+	auto TraceDistance{0.0f};
+
+	if (Character->GetGait() == AlsGaitTags::Walking)
 	{
-		if (Character->GetGait() == AlsGaitTags::Walking)
-		{
-			TraceDistance = ImpactReactionSettings.WalkingBumpDetectionDistance;
-		}
-		if (Character->GetGait() == AlsGaitTags::Running)
-		{
-			TraceDistance = ImpactReactionSettings.RunningBumpDetectionDistance;
-		}
-		if (Character->GetGait() == AlsGaitTags::Sprinting)
-		{
-			TraceDistance = ImpactReactionSettings.SprintingBumpDetectionDistance;
-		}
+		TraceDistance = ImpactReactionSettings.WalkingBumpDetectionDistance;
 	}
-	else
+	else if (Character->GetGait() == AlsGaitTags::Running)
+	{
+		TraceDistance = ImpactReactionSettings.RunningBumpDetectionDistance;
+	}
+	else if (Character->GetGait() == AlsGaitTags::Sprinting)
 	{
-		TraceDistance = 0.0f;
+		TraceDistance = ImpactReactionSettings.SprintingBumpDetectionDistance;
 	}
 
-	// const FVector EndLocation{ StartLocation + (Character->GetActorForwardVector() * TraceDistance) };
-	const FVector EndLocation{ StartLocation + (Character->GetControlRotation().Yaw * TraceDistance) };
-	// const FVector EndLocation{ StartLocation + (Character->GetControlRotation().Yaw * TraceDistance) };
-	
-	// Trace for room for Vaulting action
-	if (UKismetSystemLibrary::CapsuleTraceMultiForObjects(GetWorld(), StartLocation, EndLocation, CapsuleRadius, CapsuleHalfHeight/2, ImpactReactionSettings.BumpTraceObjectTypes, false, IgnoreActors, EDrawDebugTrace::ForOneFrame, HitResults, true, FLinearColor::Green, FLinearColor::Red, 5.0f))
+	if (TraceDistance <= 0.0f)
+	{
+		return;
+	}
+
+	const auto* Capsule{Character->GetCapsuleComponent()};
+
+	const auto CapsuleRadius{Capsule->GetScaledCapsuleRadius()};
+	const auto CapsuleHalfHeight{Capsule->GetScaledCapsuleHalfHeight()};
+
+	// Sweep the upper half of the capsule along the movement direction, so that steps and slopes are not obstacles.
+	const FVector MoveDirection{Velocity.X / Speed, Velocity.Y / Speed, 0.0f};
+	const auto TraceStart{Character->GetActorLocation() + Character->GetActorUpVector() * (CapsuleHalfHeight * 0.5f)};
+	const auto TraceEnd{TraceStart + MoveDirection * TraceDistance};
+
+	FCollisionObjectQueryParams ObjectQueryParameters;
+	for (const auto ObjectType : ImpactReactionSettings.BumpTraceObjectTypes)
+	{
+		ObjectQueryParameters.AddObjectTypesToQuery(UCollisionProfile::Get()->ConvertToCollisionChannel(false, ObjectType));
+	}
+
+	static const FName BumpTraceTag{__FUNCTION__};
+
+	FHitResult Hit;
+	GetWorld()->SweepSingleByObjectType(Hit, TraceStart, TraceEnd, FQuat::Identity, ObjectQueryParameters,
+	                                    FCollisionShape::MakeCapsule(CapsuleRadius, CapsuleHalfHeight * 0.5f),
+	                                    {BumpTraceTag, false, Character});
+
+#if ENABLE_DRAW_DEBUG
+	if (UAlsUtility::ShouldDisplayDebugForActor(Character, UAlsConstants::TracesDisplayName()))
+	{
+		UAlsUtility::DrawDebugSweepSingleCapsuleAlternative(GetWorld(), TraceStart, TraceEnd, CapsuleRadius, CapsuleHalfHeight * 0.5f,
+		                                                    Hit.IsValidBlockingHit(), Hit, FLinearColor::Green, FLinearColor::Red,
+		                                                    ImpactReactionSettings.BumpProbeInterval);
+	}
+#endif
+
+	// Obstacles the capsule already touches are reported by the movement hits.
+	if (Hit.IsValidBlockingHit() && !Hit.bStartPenetrating)
+	{
+		TryStartBump(Hit);
+	}
+}
+
+void UALSXTImpactReactionComponent::OnCapsuleHit(UPrimitiveComponent* HitComponent, AActor* OtherActor, UPrimitiveComponent* OtherComponent,
+                                                 const FVector NormalImpulse, const FHitResult& Hit)
+{
+	if (!CanDetectBumps())
+	{
+		return;
+	}
+
+	const auto* CharacterMovement{Character->GetCharacterMovement()};
+
+	// Floors and slopes the character can walk on are not obstacles.
+	if (!CharacterMovement->IsMovingOnGround() || CharacterMovement->IsWalkable(Hit) || !IsBumpObject(OtherComponent))
+	{
+		return;
+	}
+
+	// Only the speed into the surface counts, so that sliding along a wall is not a bump.
+	if (-(Character->GetVelocity() | Hit.ImpactNormal) < ImpactReactionSettings.MinBumpSpeed)
+	{
+		return;
+	}
+
+	TryStartBump(Hit);
+}
+
+bool UALSXTImpactReactionComponent::IsBumpObject(const UPrimitiveComponent* Component) const
+{
+	return IsValid(Component) &&
+	       ImpactReactionSettings.BumpTraceObjectTypes.Contains(UEngineTypes::ConvertToObjectType(Component->GetCollisionObjectType()));
+}
+
+bool UALSXTImpactReactionComponent::CanDetectBumps() const
+{
+	// Simulated proxies do not sweep their capsule, so only the authority and the owning client detect bumps.
+	return Character->GetLocalRole() > ROLE_SimulatedProxy;
+}
+
+void UALSXTImpactReactionComponent::TryStartBump(const FHitResult& Hit)
+{
+	const auto WorldTime{GetWorld()->GetTimeSeconds()};
+
+	if (LastBumpTime > 0.0 && WorldTime - LastBumpTime < ImpactReactionSettings.BumpCooldown)
+	{
+		return;
+	}
+
+	LastBumpTime = WorldTime;
+
+	// The side of the character facing the obstacle.
+	const auto LocalDirection{Character->GetActorTransform().InverseTransformVectorNoScale(-Hit.ImpactNormal)};
+
+	const FGameplayTag Side{
+		FMath::Abs(LocalDirection.X) >= FMath::Abs(LocalDirection.Y)
+			? (LocalDirection.X >= 0.0f ? ALSXTImpactSideTags::Front : ALSXTImpactSideTags::Back)
+			: (LocalDirection.Y >= 0.0f ? ALSXTImpactSideTags::Right : ALSXTImpactSideTags::Left)
+	};
+
+	const FGameplayTag Form{IsValid(Cast<APawn>(Hit.GetActor())) ? ALSXTImpactFormTags::Push : ALSXTImpactFormTags::Blunt};
+
+#if ENABLE_DRAW_DEBUG
+	if (UAlsUtility::ShouldDisplayDebugForActor(Character, UAlsConstants::TracesDisplayName()))
 	{
-		FString BumpHit = HitResults[0].GetActor()->GetName();
-		GEngine->AddOnScreenDebugMessage(-1, 15.0f, FColor::Yellow, BumpHit);
+		DrawDebugPoint(GetWorld(), Hit.ImpactPoint, 12.0f, FColor::Red, false, 2.0f);
 	}
+#endif
+
+	BumpReaction(Character->GetGait(), Side, Form);
 }
 
 
@@ -158,14 +255,8 @@ void UALSXTImpactReactionComponent::StartBumpReaction(const FGameplayTag& Gait,
 void UALSXTImpactReactionComponent::StartAttackReaction(FAttackDoubleHitResult Hit)
 {
 	UAnimMontage* Montage{ nullptr };
-	UNiagaraSystem* Particle{ nullptr };
-	TSubclassOf<AActor> ParticleActor{ nullptr };
-	USoundBase* Audio{ nullptr };
 
 	Montage = SelectAttackReactionMontage(Hit);
-	Particle = GetImpactReactionParticle(Hit.DoubleHitResult);
-	ParticleActor = GetImpactReactionParticleActor(Hit.DoubleHitResult);
-	Audio = GetImpactReactionSound(Hit.DoubleHitResult);
 
 	if (!ALS_ENSURE(IsValid(Montage)) || !IsImpactReactionAllowedToStart(Montage))
 	{
@@ -177,7 +268,7 @@ void UALSXTImpactReactionComponent::StartAttackReaction(FAttackDoubleHitResult H
 
 	Character->SetMovementModeLocked(true);
 
-	StartImpactReactionImplementation(Hit.DoubleHitResult, Montage, ParticleActor, Particle, Audio);
+	StartImpactReactionImplementation(Hit.DoubleHitResult, Montage);
 }
 
 void UALSXTImpactReactionComponent::StartSyncedAttackReaction(FAttackDoubleHitResult Hit)
@@ -191,14 +282,26 @@ void UALSXTImpactReactionComponent::StartImpactReaction(FDoubleHitResult Hit)
 	{
 		return;
 	}
-	UAnimMontage* Montage { nullptr};
-	TSubclassOf<AActor> ParticleActor{ nullptr };
-	UNiagaraSystem* Particle {nullptr};
-	USoundBase* Audio {nullptr};
+	const auto* ImpactReactionSettings{SelectImpactReactionSettings(Hit.ImpactLocation)};
+
+	if (!IsValid(ImpactReactionSettings))
+	{
+		return;
+	}
+
+	const auto& ReactionTable{ImpactReactionSettings->GetReactionTable()};
+	const auto ReactionIndex{ReactionTable.FindReaction({Hit.ImpactLocation, Hit.Strength, Hit.ImpactSide, Hit.ImpactForm})};
+
+	if (ReactionIndex == INDEX_NONE || ReactionIndex > MAX_uint16)
+	{
+		GEngine->AddOnScreenDebugMessage(-1, 15.0f, FColor::Yellow, TEXT("Montage Invalid"));
+		return;
+	}
 
-	Montage = SelectImpactReactionMontage(Hit);
-	Particle = GetImpactReactionParticle(Hit);
-	Audio = GetImpactReactionSound(Hit);
+	// The no-repeat pick happens once here, other machines play the montage it picked.
+	const auto bBlocking{Character->IsBlocking()};
+	const auto MontageIndex{ReactionTable.SelectMontageIndex(ReactionIndex, bBlocking, ReactionRandomStream, ReactionHistory)};
+	auto* Montage{ReactionTable.GetMontage(ReactionIndex, bBlocking, MontageIndex)};
 
 	if (!ALS_ENSURE(IsValid(Montage)) || !IsImpactReactionAllowedToStart(Montage))
 	{
@@ -216,14 +319,14 @@ void UALSXTImpactReactionComponent::StartImpactReaction(FDoubleHitResult Hit)
 	{
 		Character->GetCharacterMovement()->NetworkSmoothingMode = ENetworkSmoothingMode::Disabled;
 		// Character->GetMesh()->SetRelativeLocationAndRotation(BaseTranslationOffset, BaseRotationOffset);
-		MulticastStartImpactReaction(Hit, Montage, ParticleActor, Particle, Audio);
+		MulticastStartImpactReaction(Hit, static_cast<uint16>(ReactionIndex), static_cast<uint16>(MontageIndex), bBlocking, false);
 	}
 	else
 	{
 		Character->GetCharacterMovement()->FlushServerMoves();
 
-		StartImpactReactionImplementation(Hit, Montage, ParticleActor, Particle, Audio);
-		ServerStartImpactReaction(Hit, Montage, ParticleActor, Particle, Audio);
+		StartImpactReactionImplementation(Hit, Montage);
+		ServerStartImpactReaction(Hit, static_cast<uint16>(ReactionIndex), static_cast<uint16>(MontageIndex), bBlocking);
 		OnImpactReactionStarted(Hit);
 	}
 }
@@ -271,151 +374,40 @@ UAnimMontage* UALSXTImpactReactionComponent::SelectBumpReactionMontage_Implement
 
 UAnimMontage* UALSXTImpactReactionComponent::SelectAttackReactionMontage_Implementation(FAttackDoubleHitResult Hit)
 {
-	UAnimMontage* SelectedMontage{ nullptr };
-	FActionMontageInfo LastAnimation{ nullptr };
-	FGameplayTag ImpactLoc = Hit.DoubleHitResult.ImpactLocation;
+	const auto* AttackReactionSettings{SelectAttackReactionSettings(Hit.DoubleHitResult.ImpactLocation)};
 
-	UALSXTAttackReactionSettings* AttackReactionSettings = SelectAttackReactionSettings(ImpactLoc);
-
-	for (int i = 0; i < AttackReactionSettings->ImpactReactionLocations.Num(); ++i)
+	if (!IsValid(AttackReactionSettings))
 	{
-		if (AttackReactionSettings->ImpactReactionLocations[i].ImpactReactionLocation == Hit.DoubleHitResult.ImpactLocation)
-		{
-			for (int j = 0; j < AttackReactionSettings->ImpactReactionLocations[i].ImpactReactionStrengths.Num(); ++j)
-			{
-				if (AttackReactionSettings->ImpactReactionLocations[i].ImpactReactionStrengths[j].ImpactReactionStrength == Hit.Strength)
-				{
-					for (int k = 0; k < AttackReactionSettings->ImpactReactionLocations[i].ImpactReactionStrengths[j].ImpactReactionSides.Num(); ++k)
-					{
-						if (AttackReactionSettings->ImpactReactionLocations[i].ImpactReactionStrengths[j].ImpactReactionSides[k].ImpactReactionSide == Hit.DoubleHitResult.ImpactSide)
-						{
-							for (int l = 0; l < AttackReactionSettings->ImpactReactionLocations[i].ImpactReactionStrengths[j].ImpactReactionSides[k].ImpactReactionForms.Num(); ++l)
-							{
-								if (AttackReactionSettings->ImpactReactionLocations[i].ImpactReactionStrengths[j].ImpactReactionSides[k].ImpactReactionForms[l].ImpactReactionForm == Hit.DoubleHitResult.ImpactForm)
-								{
-									FImpactForm SelectedEntry { AttackReactionSettings->ImpactReactionLocations[i].ImpactReactionStrengths[j].ImpactReactionSides[k].ImpactReactionForms[l] };
-
-									// Determine if Blocking and Declare Local Copy of Montages Array
-									TArray<FActionMontageInfo> MontageArray;
-									if (Character->IsBlocking()) 
-									{
-										MontageArray = SelectedEntry.BlockingMontages;
-									}
-									else
-									{
-										MontageArray = SelectedEntry.RegularMontages;
-									}
-	
-									if (MontageArray.Num() > 1)
-									{
-										// If LastAnimation exists, remove it from Local Montages array to avoid duplicates
-										// if (LastAnimation.Montage)
-										// {
-										// 	MontageArray.Remove(LastAnimation);
-										// }
-	
-										//Shuffle Array
-										for (int m = MontageArray.Max(); m >= 0; --m)
-										{
-											int n = FMath::Rand() % (m + 1);
-											if (m != n) MontageArray.Swap(m, n);
-										}
-	
-										// Select Random Array Entry
-										int RandIndex = rand() % MontageArray.Max();
-										SelectedMontage = MontageArray[RandIndex].Montage;
-										return SelectedMontage;
-									}
-									else
-									{
-										if (MontageArray[0].Montage) 
-										{
-											SelectedMontage = MontageArray[0].Montage;
-										}
-										else
-										{
-											SelectedMontage = SelectedEntry.DefaultFallbackMontage.Montage;
-										}
-										return SelectedMontage;
-									}
-								}
-							}
-						}
-					}
-				}
-			}
-		}
+		return nullptr;
 	}
-	return SelectedMontage;
+
+	const FALSXTReactionKey Key{Hit.DoubleHitResult.ImpactLocation, Hit.Strength, Hit.DoubleHitResult.ImpactSide, Hit.DoubleHitResult.ImpactForm};
+
+	return AttackReactionSettings->GetReactionTable().SelectMontage(Key, Character->IsBlocking(), ReactionRandomStream, ReactionHistory);
 }
 
 UAnimMontage* UALSXTImpactReactionComponent::SelectImpactReactionMontage_Implementation(FDoubleHitResult Hit)
 {
-	UAnimMontage* SelectedMontage { nullptr };
-	FActionMontageInfo LastAnimation { nullptr };
-	FGameplayTag ImpactLoc = Hit.ImpactLocation;
+	const auto* ImpactReactionSettings{SelectImpactReactionSettings(Hit.ImpactLocation)};
 
-	UALSXTImpactReactionSettings* SelectedImpactReactionSettings = SelectImpactReactionSettings(ImpactLoc);
-
-	for (int i = 0; i < SelectedImpactReactionSettings->ImpactReactionLocations.Num(); ++i)
+	if (!IsValid(ImpactReactionSettings))
 	{
-		if (SelectedImpactReactionSettings->ImpactReactionLocations[i].ImpactReactionLocation == Hit.ImpactLocation)
-		{
-			for (int j = 0; j < SelectedImpactReactionSettings->ImpactReactionLocations[i].ImpactReactionStrengths.Num(); ++j)
-			{
-				if (SelectedImpactReactionSettings->ImpactReactionLocations[i].ImpactReactionStrengths[j].ImpactReactionStrength == Hit.Strength)
-				{
-					for (int k = 0; k < SelectedImpactReactionSettings->ImpactReactionLocations[i].ImpactReactionStrengths[j].ImpactReactionSides.Num(); ++k)
-					{
-						if (SelectedImpactReactionSettings->ImpactReactionLocations[i].ImpactReactionStrengths[j].ImpactReactionSides[k].ImpactReactionSide == Hit.ImpactSide)
-						{
-							for (int l = 0; l < SelectedImpactReactionSettings->ImpactReactionLocations[i].ImpactReactionStrengths[j].ImpactReactionSides[k].ImpactReactionForms.Num(); ++l)
-							{
-								if (SelectedImpactReactionSettings->ImpactReactionLocations[i].ImpactReactionStrengths[j].ImpactReactionSides[k].ImpactReactionForms[l].ImpactReactionForm == Hit.ImpactForm)
-								{
-									
-									// Determine if Blocking and Declare Local Copy of Montages Array
-									TArray<FActionMontageInfo> MontageArray;
-									if (Character->IsBlocking())
-									{
-										MontageArray = SelectedImpactReactionSettings->ImpactReactionLocations[i].ImpactReactionStrengths[j].ImpactReactionSides[k].ImpactReactionForms[l].BlockingMontages;
-									}
-									else
-									{
-										MontageArray = SelectedImpactReactionSettings->ImpactReactionLocations[i].ImpactReactionStrengths[j].ImpactReactionSides[k].ImpactReactionForms[l].RegularMontages;
-									}
-									if (MontageArray.Num() > 1)
-									{
-										// If LastAnimation exists, remove it from Local Montages array to avoid duplicates
-										// if (LastAnimation.Montage)
-										// {
-										// 	MontageArray.Remove(LastAnimation);
-										// }
-
-										//Shuffle Array
-										for (int m = MontageArray.Max(); m >= 0; --m)
-										{
-											int n = FMath::Rand() % (m + 1);
-											if (m != n) MontageArray.Swap(m, n);
-										}
-
-										// Select Random Array Entry
-										int RandIndex = rand() % MontageArray.Max();
-										SelectedMontage = MontageArray[RandIndex].Montage;
-									}
-									else
-									{
-										SelectedMontage = MontageArray[0].Montage;
-									}
-								}
-							}
-						}
-					}
-				}
-			}
-		}
+		return nullptr;
 	}
-	return SelectedMontage;
+
+	const FALSXTReactionKey Key{Hit.ImpactLocation, Hit.Strength, Hit.ImpactSide, Hit.ImpactForm};
+
+	return ImpactReactionSettings->GetReactionTable().SelectMontage(Key, Character->IsBlocking(), ReactionRandomStream, ReactionHistory);
+}
+
+UAnimMontage* UALSXTImpactReactionComponent::ResolveImpactReactionMontage(const FDoubleHitResult& Hit, const int32 ReactionIndex,
+                                                                         const int32 MontageIndex, const bool bBlocking)
+{
+	const auto* ImpactReactionSettings{SelectImpactReactionSettings(Hit.ImpactLocation)};
+
+	return IsValid(ImpactReactionSettings)
+		       ? ImpactReactionSettings->GetReactionTable().GetMontage(ReactionIndex, bBlocking, MontageIndex)
+		       : nullptr;
 }
 
 FSyncedAttackAnimation UALSXTImpactReactionComponent::GetSyncedMontage_Implementation(const FGameplayTag& Overlay, FAttackDoubleHitResult Hit, const FGameplayTag& AttackType, const FGameplayTag& Stance, const FGameplayTag& Strength, const FGameplayTag& AttackMode, int Index)
@@ -448,12 +440,12 @@ UAnimMontage* UALSXTImpactReactionComponent::SelectResponseMontage_Implementatio
 	return SelectedMontage;
 }
 
-bool UALSXTImpactReactionComponent::ServerAttackReaction_Validate(FAttackDoubleHitResult Hit)
+bool UALSXTImpactReactionComponent::ServerAttackReaction_Validate(const FAttackDoubleHitResult& Hit)
 {
 	return true;
 }
 
-void UALSXTImpactReactionComponent::ServerAttackReaction_Implementation(FAttackDoubleHitResult Hit)
+void UALSXTImpactReactionComponent::ServerAttackReaction_Implementation(const FAttackDoubleHitResult& Hit)
 {
 	// MulticastAttackReaction(Hit);
 	StartAttackReaction(Hit);
@@ -461,41 +453,53 @@ void UALSXTImpactReactionComponent::ServerAttackReaction_Implementation(FAttackD
 }
 
 
-void UALSXTImpactReactionComponent::MulticastAttackReaction_Implementation(FAttackDoubleHitResult Hit)
+void UALSXTImpactReactionComponent::MulticastAttackReaction_Implementation(const FAttackDoubleHitResult& Hit)
 {
 	StartAttackReaction(Hit);
 }
 
-void UALSXTImpactReactionComponent::ServerImpactReaction_Implementation(FDoubleHitResult Hit)
+void UALSXTImpactReactionComponent::ServerImpactReaction_Implementation(const FDoubleHitResult& Hit)
 {
 	MulticastImpactReaction(Hit);
 	Character->ForceNetUpdate();
 }
 
-void UALSXTImpactReactionComponent::MulticastImpactReaction_Implementation(FDoubleHitResult Hit)
+void UALSXTImpactReactionComponent::MulticastImpactReaction_Implementation(const FDoubleHitResult& Hit)
 {
 	StartImpactReaction(Hit);
 }
 
-void UALSXTImpactReactionComponent::ServerStartImpactReaction_Implementation(FDoubleHitResult Hit, UAnimMontage* Montage, TSubclassOf<AActor> ParticleActor, UNiagaraSystem* Particle, USoundBase* Audio)
+void UALSXTImpactReactionComponent::ServerStartImpactReaction_Implementation(const FDoubleHitResult& Hit, const uint16 ReactionIndex,
+                                                                             const uint16 MontageIndex, const bool bBlocking)
 {
-	if (IsImpactReactionAllowedToStart(Montage))
+	if (IsImpactReactionAllowedToStart(ResolveImpactReactionMontage(Hit, ReactionIndex, MontageIndex, bBlocking)))
 	{
-		MulticastStartImpactReaction(Hit, Montage, ParticleActor, Particle, Audio);
+		MulticastStartImpactReaction(Hit, ReactionIndex, MontageIndex, bBlocking, true);
 		Character->ForceNetUpdate();
 	}
 }
 
-void UALSXTImpactReactionComponent::MulticastStartImpactReaction_Implementation(FDoubleHitResult Hit, UAnimMontage* Montage, TSubclassOf<AActor> ParticleActor, UNiagaraSystem* Particle, USoundBase* Audio)
+void UALSXTImpactReactionComponent::MulticastStartImpactReaction_Implementation(const FDoubleHitResult& Hit, const uint16 ReactionIndex,
+                                                                                const uint16 MontageIndex, const bool bBlocking,
+                                                                                const bool bPredicted)
 {
-	StartImpactReactionImplementation(Hit, Montage, ParticleActor, Particle, Audio);
+	// The owning client already plays the reaction it predicted.
+	if (bPredicted && Character->GetLocalRole() == ROLE_AutonomousProxy)
+	{
+		return;
+	}
+
+	StartImpactReactionImplementation(Hit, ResolveImpactReactionMontage(Hit, ReactionIndex, MontageIndex, bBlocking));
 }
 
-void UALSXTImpactReactionComponent::StartImpactReactionImplementation(FDoubleHitResult Hit, UAnimMontage* Montage, TSubclassOf<AActor> ParticleActor, UNiagaraSystem* Particle, USoundBase* Audio)
+void UALSXTImpactReactionComponent::StartImpactReactionImplementation(FDoubleHitResult Hit, UAnimMontage* Montage)
 {	
 	//if (IsImpactReactionAllowedToStart(Montage) && Character->GetMesh()->GetAnimInstance()->Montage_Play(Montage, 1.0f))
 	if (IsImpactReactionAllowedToStart(Montage))
 	{
+		auto* Audio{GetImpactReactionSound(Hit)};
+		const auto ParticleActor{GetImpactReactionParticleActor(Hit)};
+
 		//Anticipation
 		FALSXTDefensiveModeState DefensiveModeState;
 		DefensiveModeState.Mode = Character->GetDefensiveMode();
@@ -508,25 +512,22 @@ void UALSXTImpactReactionComponent::StartImpactReactionImplementation(FDoubleHit
 
 		UAudioComponent* AudioComponent{ nullptr };
 
-		//Calculate Rotation from Normal Vector
-		FVector UpVector = Hit.HitResult.HitResult.GetActor()->GetRootComponent()->GetUpVector();
-		FVector NormalVector = Hit.HitResult.HitResult.ImpactNormal;
-		FVector RotationAxis = FVector::CrossProduct(UpVector, NormalVector);
-		RotationAxis.Normalize();
-		float DotProduct = FVector::DotProduct(UpVector, NormalVector);
-		float RotationAngle = acosf(DotProduct);
-		FQuat Quat = FQuat(RotationAxis, RotationAngle);
-		FQuat RootQuat = Hit.HitResult.HitResult.GetActor()->GetRootComponent()->GetComponentQuat();
-		FQuat NewQuat = Quat * RootQuat;
-		FRotator NewRotation = NewQuat.Rotator();
+		const auto NewRotation{CalculateImpactSurfaceRotation(Hit).Rotator()};
 
 		if (Audio)
 		{
+			auto* AudioPool{GetWorld()->GetSubsystem<UALSXTAudioEmitterSubsystem>()};
+
 			if (GetWorld()->WorldType == EWorldType::EditorPreview)
 			{
 				UGameplayStatics::PlaySoundAtLocation(GetWorld(), Audio, Hit.HitResult.HitResult.ImpactPoint,
 					1.0f, 1.0f);
 			}
+			else if (IsValid(AudioPool))
+			{
+				AudioComponent = AudioPool->PlaySoundAtLocation(EALSXTAudioEmitterCategory::Impact, Audio,
+					Hit.HitResult.HitResult.ImpactPoint, NewRotation);
+			}
 			else
 			{
 				AudioComponent = UGameplayStatics::SpawnSoundAtLocation(GetWorld(), Audio, Hit.HitResult.HitResult.ImpactPoint,
@@ -556,49 +557,39 @@ void UALSXTImpactReactionComponent::StartImpactReactionImplementation(FDoubleHit
 	}
 }
 
-bool UALSXTImpactReactionComponent::ServerSpawnParticleActor_Validate(FDoubleHitResult Hit, TSubclassOf<AActor> ParticleActor)
+bool UALSXTImpactReactionComponent::ServerSpawnParticleActor_Validate(const FDoubleHitResult& Hit, TSubclassOf<AActor> ParticleActor)
 {
 	return true;
 }
 
-void UALSXTImpactReactionComponent::ServerSpawnParticleActor_Implementation(FDoubleHitResult Hit, TSubclassOf<AActor> ParticleActor)
+void UALSXTImpactReactionComponent::ServerSpawnParticleActor_Implementation(const FDoubleHitResult& Hit, TSubclassOf<AActor> ParticleActor)
 {
 	SpawnParticleActorImplementation(Hit, ParticleActor);
 }
 
 
-void UALSXTImpactReactionComponent::MulticastSpawnParticleActor_Implementation(FDoubleHitResult Hit, TSubclassOf<AActor> ParticleActor)
+void UALSXTImpactReactionComponent::MulticastSpawnParticleActor_Implementation(const FDoubleHitResult& Hit, TSubclassOf<AActor> ParticleActor)
+{
+	SpawnParticleActorImplementation(Hit, ParticleActor);
+}
+
+void UALSXTImpactReactionComponent::SpawnParticleActorImplementation(FDoubleHitResult Hit, TSubclassOf<AActor> ParticleActor)
 {
 	if (UKismetSystemLibrary::IsValidClass(ParticleActor))
 	{
+		const FTransform SpawnTransform{CalculateImpactSurfaceRotation(Hit), Hit.HitResult.HitResult.Location};
+		auto* EffectPool{GetWorld()->GetSubsystem<UALSXTImpactEffectPoolSubsystem>()};
 
-		//Calculate Rotation from Normal Vector
-		FVector UpVector = Hit.HitResult.HitResult.GetActor()->GetRootComponent()->GetUpVector();
-		FVector NormalVector = Hit.HitResult.HitResult.ImpactNormal;
-		FVector RotationAxis = FVector::CrossProduct(UpVector, NormalVector);
-		RotationAxis.Normalize();
-		float DotProduct = FVector::DotProduct(UpVector, NormalVector);
-		float RotationAngle = acosf(DotProduct);
-		FQuat Quat = FQuat(RotationAxis, RotationAngle);
-		FQuat RootQuat = Hit.HitResult.HitResult.GetActor()->GetRootComponent()->GetComponentQuat();
-		FQuat NewQuat = Quat * RootQuat;
-		FRotator NewRotation = NewQuat.Rotator();
-
-		FTransform SpawnTransform = FTransform(NewRotation, Hit.HitResult.HitResult.Location, { 1.0f, 1.0f, 1.0f });
-		AActor* SpawnedActor;
-		FActorSpawnParameters SpawnInfo;
-		SpawnInfo.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
-
-		// GetWorld()->SpawnActor<AActor>(ParticleActor->StaticClass(), SpawnTransform, SpawnInfo);
-		SpawnedActor = GetWorld()->SpawnActor<AActor>(ParticleActor->StaticClass(), SpawnTransform, SpawnInfo);
-
-		if (IsValid(SpawnedActor))
+		if (IsValid(EffectPool))
 		{
-			GEngine->AddOnScreenDebugMessage(-1, 15.0f, FColor::Yellow, SpawnedActor->GetActorLocation().ToString());
+			EffectPool->AcquireEffect(ParticleActor, SpawnTransform);
 		}
 		else
 		{
-			GEngine->AddOnScreenDebugMessage(-1, 15.0f, FColor::Yellow, TEXT("SpawnedActor Not Valid"));
+			FActorSpawnParameters SpawnInfo;
+			SpawnInfo.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+
+			GetWorld()->SpawnActor<AActor>(ParticleActor, SpawnTransform, SpawnInfo);
 		}
 	}
 	else
@@ -607,34 +598,18 @@ void UALSXTImpactReactionComponent::MulticastSpawnParticleActor_Implementation(F
 	}
 }
 
-void UALSXTImpactReactionComponent::SpawnParticleActorImplementation(FDoubleHitResult Hit, TSubclassOf<AActor> ParticleActor)
+FQuat UALSXTImpactReactionComponent::CalculateImpactSurfaceRotation(const FDoubleHitResult& Hit) const
 {
-	if (UKismetSystemLibrary::IsValidClass(ParticleActor))
-	{
-
-		//Calculate Rotation from Normal Vector
-		FVector UpVector = Hit.HitResult.HitResult.GetActor()->GetRootComponent()->GetUpVector();
-		FVector NormalVector = Hit.HitResult.HitResult.ImpactNormal;
-		FVector RotationAxis = FVector::CrossProduct(UpVector, NormalVector);
-		RotationAxis.Normalize();
-		float DotProduct = FVector::DotProduct(UpVector, NormalVector);
-		float RotationAngle = acosf(DotProduct);
-		FQuat Quat = FQuat(RotationAxis, RotationAngle);
-		FQuat RootQuat = Hit.HitResult.HitResult.GetActor()->GetRootComponent()->GetComponentQuat();
-		FQuat NewQuat = Quat * RootQuat;
-		FRotator NewRotation = NewQuat.Rotator();
-
-		FTransform SpawnTransform = FTransform(NewRotation, Hit.HitResult.HitResult.Location, { 1.0f, 1.0f, 1.0f });
-		AActor* SpawnedActor;
-		FActorSpawnParameters SpawnInfo;
-		SpawnInfo.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+	// Rotates the hit actor up vector onto the impact normal, so effects follow the surface they hit.
+	const auto* HitActor{Hit.HitResult.HitResult.GetActor()};
+	const auto* HitRoot{IsValid(HitActor) ? HitActor->GetRootComponent() : nullptr};
 
-		SpawnedActor = GetWorld()->SpawnActor<AActor>(ParticleActor, SpawnTransform, SpawnInfo);
-	}
-	else
+	if (!IsValid(HitRoot))
 	{
-		GEngine->AddOnScreenDebugMessage(-1, 15.0f, FColor::Yellow, TEXT("ParticleActor Invalid"));
+		return FQuat::FindBetweenNormals(FVector::UpVector, Hit.HitResult.HitResult.ImpactNormal);
 	}
+
+	return FQuat::FindBetweenNormals(HitRoot->GetUpVector(), Hit.HitResult.HitResult.ImpactNormal) * HitRoot->GetComponentQuat();
 }
 
 void UALSXTImpactReactionComponent::RefreshImpactReaction(const float DeltaTime)
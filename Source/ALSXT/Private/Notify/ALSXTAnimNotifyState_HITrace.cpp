@@ -43,6 +43,29 @@ void UALSXTAnimNotifyState_HITrace::NotifyBegin(USkeletalMeshComponent* Mesh, UA
 	}
 }
 
+void UALSXTAnimNotifyState_HITrace::NotifyTick(USkeletalMeshComponent* Mesh, UAnimSequenceBase* Animation,
+	const float FrameDeltaTime, const FAnimNotifyEventReference& EventReference)
+{
+	Super::NotifyTick(Mesh, Animation, FrameDeltaTime, EventReference);
+
+	auto* Character{ Cast<AALSXTCharacter>(Mesh->GetOwner()) };
+
+	if (IsValid(Character) && Character->IsAttackCollisionTraceActive())
+	{
+		bool Found;
+		FVector Start;
+		FVector End;
+		float Radius;
+
+		Character->GetHeldItemTraceLocations(Found, Start, End, Radius);
+
+		if (Found)
+		{
+			Character->UpdateAttackCollisionTrace(Start, End, Radius);
+		}
+	}
+}
+
 void UALSXTAnimNotifyState_HITrace::NotifyEnd(USkeletalMeshComponent* Mesh, UAnimSequenceBase* Animation,
 	const FAnimNotifyEventReference& EventReference)
 {
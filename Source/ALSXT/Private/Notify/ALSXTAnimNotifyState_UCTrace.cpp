@@ -39,6 +39,24 @@ void UALSXTAnimNotifyState_UCTrace::NotifyBegin(USkeletalMeshComponent* Mesh, UA
 	}
 }
 
+void UALSXTAnimNotifyState_UCTrace::NotifyTick(USkeletalMeshComponent* Mesh, UAnimSequenceBase* Animation,
+	const float FrameDeltaTime, const FAnimNotifyEventReference& EventReference)
+{
+	Super::NotifyTick(Mesh, Animation, FrameDeltaTime, EventReference);
+
+	auto* Character{ Cast<AALSXTCharacter>(Mesh->GetOwner()) };
+
+	if (IsValid(Character) && Character->IsAttackCollisionTraceActive())
+	{
+		FVector Start;
+		FVector End;
+		float Radius;
+
+		Character->GetUnarmedTraceLocations(UnarmedAttackType, Start, End, Radius);
+		Character->UpdateAttackCollisionTrace(Start, End, Radius);
+	}
+}
+
 void UALSXTAnimNotifyState_UCTrace::NotifyEnd(USkeletalMeshComponent* Mesh, UAnimSequenceBase* Animation,
 	const FAnimNotifyEventReference& EventReference)
 {
@@ -11,6 +11,7 @@
 #include "Components/CapsuleComponent.h"
 #include "Components/DecalComponent.h"
 #include "Kismet/GameplayStatics.h"
+#include "Materials/MaterialInstanceDynamic.h"
 #include "PhysicalMaterials/PhysicalMaterial.h"
 #include "Utility/AlsConstants.h"
 #include "Utility/AlsEnumUtility.h"
@@ -18,9 +19,134 @@
 #include "Utility/AlsMath.h"
 #include "Utility/AlsUtility.h"
 #include "State/ALSXTFootstepState.h"
+#include "Subsystems/ALSXTFootprintDecalSubsystem.h"
+#include "Subsystems/ALSXTAudioEmitterSubsystem.h"
+#include "Subsystems/ALSXTEffectsSchedulerSubsystem.h"
+#include "Subsystems/ALSXTEffectsSignificanceSubsystem.h"
+#include "Subsystems/ALSXTFootSurfaceProbeSubsystem.h"
+#include "Utility/ALSXTFootprintMaterialCache.h"
 #include "Engine/GameEngine.h"
 #include "Math/UnrealMathUtility.h"
 
+void FALSXTFootstepEffectSettings::ApplyToFootprintPhase(FALSXTFootprintStatePhase& Phase) const
+{
+	Phase.TransferDetailTexture = TransferDetailTexture;
+	Phase.TransferPrimaryColor = TransferPrimaryColor;
+	Phase.TransferSecondaryColor = TransferSecondaryColor;
+	Phase.TransferWetness = TransferWetness;
+	Phase.TransferSaturationRate = TransferSaturationRate;
+	Phase.TransferDesaturationRate = TransferDesaturationRate;
+	Phase.TransferEmissiveAmount = TransferEmissive;
+	Phase.DecalDuration = DecalDuration;
+	Phase.DecalFadeOutDuration = DecalFadeOutDuration;
+	Phase.DecalDurationModifierMin = DecalDurationModifierMin;
+	Phase.DecalDurationModifierMax = DecalDurationModifierMax;
+	Phase.SurfaceTransferAcceptanceAmount = SurfaceTransferAcceptanceAmount;
+	Phase.TransferDetailScale = TransferDetailScale;
+	Phase.TransferAmount = TransferAmount;
+	Phase.SurfaceTransferAmount = SurfaceTransferAmount;
+	Phase.TransferNormalScale = TransferNormalScale;
+	Phase.TransferGrainSize = TransferGrainSize;
+	Phase.SurfaceTransferAcceptanceNormalScale = SurfaceTransferAcceptanceNormalScale;
+	Phase.TransferDetailNormalAmount = TransferDetailNormalAmount;
+}
+
+void UALSXTFootstepEffectsSettings::PostLoad()
+{
+	Super::PostLoad();
+
+	CompileEffects();
+}
+
+void UALSXTFootstepEffectsSettings::BeginDestroy()
+{
+	Preloader.Release();
+
+	Super::BeginDestroy();
+}
+
+#if WITH_EDITOR
+void UALSXTFootstepEffectsSettings::PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent)
+{
+	Super::PostEditChangeProperty(PropertyChangedEvent);
+
+	CompileEffects();
+
+	if (Preloader.IsRequested())
+	{
+		RequestPreload();
+	}
+}
+#endif
+
+void UALSXTFootstepEffectsSettings::CompileEffects()
+{
+	EffectTable.Compile(Effects);
+}
+
+const FALSXTFootstepEffectSettings* UALSXTFootstepEffectsSettings::FindEffectSettings(const EPhysicalSurface SurfaceType) const
+{
+	if (!EffectTable.IsCompiled())
+	{
+		EffectTable.Compile(Effects);
+	}
+
+	return EffectTable.Find(SurfaceType);
+}
+
+void UALSXTFootstepEffectsSettings::RequestPreload()
+{
+	TArray<FSoftObjectPath> AssetPaths;
+
+	for (const auto& Pair : Effects)
+	{
+		AssetPaths.Add(Pair.Value.Sound.ToSoftObjectPath());
+		AssetPaths.Add(Pair.Value.DecalMaterial.ToSoftObjectPath());
+		AssetPaths.Add(Pair.Value.ParticleSystem.ToSoftObjectPath());
+		AssetPaths.Add(Pair.Value.FootstepParticles.WalkParticleSystem.ToSoftObjectPath());
+		AssetPaths.Add(Pair.Value.FootstepParticles.RunParticleSystem.ToSoftObjectPath());
+		AssetPaths.Add(Pair.Value.FootstepParticles.LandParticleSystem.ToSoftObjectPath());
+	}
+
+	Preloader.Request(MoveTemp(AssetPaths), GetName());
+}
+
+FALSXTEffectsPreloadInfo UALSXTFootstepEffectsSettings::GetPreloadInfo() const
+{
+	return Preloader.GetInfo();
+}
+
+void UALSXTFootstepEffectsSettings::RebuildFootprintState(const FALSXTFootprintNetState& NetState, FALSXTFootprintState& State) const
+{
+	if (State.Current.SurfaceType != NetState.CurrentSurfaceType)
+	{
+		const auto* EffectSettings{FindEffectSettings(NetState.CurrentSurfaceType)};
+
+		if (EffectSettings != nullptr)
+		{
+			EffectSettings->ApplyToFootprintPhase(State.Current);
+		}
+	}
+
+	if (State.Previous.SurfaceType != NetState.PreviousSurfaceType)
+	{
+		const auto* EffectSettings{FindEffectSettings(NetState.PreviousSurfaceType)};
+
+		if (EffectSettings != nullptr)
+		{
+			EffectSettings->ApplyToFootprintPhase(State.Previous);
+		}
+	}
+
+	NetState.ApplyTo(State);
+}
+
+void UALSXTFootstepEffectsSettings::RebuildFootprintsState(const FALSXTFootprintsNetState& NetState, FALSXTFootprintsState& State) const
+{
+	RebuildFootprintState(NetState.Left, State.Left);
+	RebuildFootprintState(NetState.Right, State.Right);
+}
+
 FString UALSXTAnimNotify_FootstepEffects::GetNotifyName_Implementation() const
 {
 	return FString::Format(TEXT("ALSXT Footstep Effects: {0}"), { AlsEnumUtility::GetNameStringByValue(FootBone) });
@@ -50,19 +176,29 @@ void UALSXTAnimNotify_FootstepEffects::Notify(USkeletalMeshComponent* Mesh, UAni
 		return;
 	}
 
-	const auto* Character{Cast<AAlsCharacter>(Mesh->GetOwner())};
-	AALSXTCharacter* ALSXTCharacter{Cast<AALSXTCharacter>(Mesh->GetOwner())};
+	const auto* ALSXTCharacter{Cast<AALSXTCharacter>(Mesh->GetOwner())};
 
 	if (bSkipEffectsWhenInAir && IsValid(ALSXTCharacter) && ALSXTCharacter->GetLocomotionMode() == AlsLocomotionModeTags::InAir)
 	{
 		return;
 	}
 
-	const auto CapsuleScale{IsValid(ALSXTCharacter) ? ALSXTCharacter->GetCapsuleComponent()->GetComponentScale().Z : 1.0f};
+	// The footprints state is replicated from the machine that controls the character, so it is updated
+	// there regardless of which effects are spawned.
+	const auto bUpdateFootprintsState{
+		IsValid(ALSXTCharacter) && (ALSXTCharacter->IsLocallyControlled() ||
+		                            (ALSXTCharacter->HasAuthority() && ALSXTCharacter->GetRemoteRole() != ROLE_AutonomousProxy))
+	};
 
-	const auto* World{Mesh->GetWorld()};
-	const auto* AnimationInstance{Mesh->GetAnimInstance()};
-	const auto* ALSXTAnimationInstance{ Cast<UALSXTAnimationInstance>(Mesh->GetAnimInstance()) };
+	// Distant and off-screen characters, as well as dedicated servers, skip the surface probe unless the footprints state needs it.
+	const auto Significance{UALSXTEffectsSignificanceSubsystem::GetSignificance(Mesh)};
+
+	if (Significance == EALSXTEffectsSignificance::None && !bUpdateFootprintsState)
+	{
+		return;
+	}
+
+	const auto CapsuleScale{IsValid(ALSXTCharacter) ? ALSXTCharacter->GetCapsuleComponent()->GetComponentScale().Z : 1.0f};
 
 	const auto FootBoneName{FootBone == EALSXTFootBone::Left ? UAlsConstants::FootLeftBoneName() : UAlsConstants::FootRightBoneName()};
 	const auto FootTransform{Mesh->GetSocketTransform(FootBoneName)};
@@ -73,32 +209,119 @@ void UALSXTAnimNotify_FootstepEffects::Notify(USkeletalMeshComponent* Mesh, UAni
 												 : FootstepEffectsSettings->FootRightZAxis)
 	};
 
-	FHitResult Hit;
-	bool NewSurface;
-	FVector HitLocation;
-	FVector HitNormal;
-	TWeakObjectPtr<UPrimitiveComponent> HitComponent;
-	TWeakObjectPtr<UPhysicalMaterial> HitPhysicalMaterial;
+	FALSXTFootSurfaceProbeRequest ProbeRequest;
+	ProbeRequest.Mesh = Mesh;
+	ProbeRequest.Foot = FootBone;
+	ProbeRequest.Start = FootTransform.GetLocation();
+	ProbeRequest.End = ProbeRequest.Start - FootZAxis * (FootstepEffectsSettings->SurfaceTraceDistance * CapsuleScale);
+	ProbeRequest.TraceChannel = UEngineTypes::ConvertToCollisionChannel(FootstepEffectsSettings->SurfaceTraceChannel);
+	ProbeRequest.ReuseDistance = FootstepEffectsSettings->SurfaceTraceReuseDistance * CapsuleScale;
+
+	// This notify is shared by every mesh that plays the animation, so the foot transform is captured for the callback.
+	auto SpawnEffectsDelegate{
+		FALSXTFootSurfaceProbeDelegate::CreateWeakLambda(this, [this, WeakMesh = TWeakObjectPtr<USkeletalMeshComponent>{Mesh}, FootTransform, Significance,
+			                                                 bUpdateFootprintsState](const FHitResult& Hit)
+		{
+			if (!WeakMesh.IsValid())
+			{
+				return;
+			}
+
+			if (bUpdateFootprintsState)
+			{
+				UpdateFootprintsState(WeakMesh.Get(), Hit);
+			}
+
+			if (Significance != EALSXTEffectsSignificance::None)
+			{
+				ScheduleEffects(WeakMesh.Get(), FootTransform, Hit, Significance);
+			}
+		})
+	};
+
+	UALSXTFootSurfaceProbeSubsystem::ProbeSurface(Mesh->GetWorld(), ProbeRequest, MoveTemp(SpawnEffectsDelegate));
+}
+
+void UALSXTAnimNotify_FootstepEffects::UpdateFootprintsState(USkeletalMeshComponent* Mesh, const FHitResult& Hit) const
+{
+	auto* ALSXTCharacter{Cast<AALSXTCharacter>(Mesh->GetOwner())};
+
+	if (!IsValid(ALSXTCharacter) || !IsValid(FootstepEffectsSettings))
+	{
+		return;
+	}
+
+	const auto NewSurfaceType{UGameplayStatics::GetSurfaceType(Hit)};
+	const auto* EffectSettings{FootstepEffectsSettings->FindEffectSettings(NewSurfaceType)};
+
+	if (EffectSettings == nullptr)
+	{
+		return;
+	}
+
+	auto NewFootprintsState{ALSXTCharacter->GetFootprintsState()};
+	auto& NewFootprintState{FootBone == EALSXTFootBone::Left ? NewFootprintsState.Left : NewFootprintsState.Right};
+
+	if (NewSurfaceType != NewFootprintState.Current.SurfaceType)
+	{
+		//Set Current as Previous
+		NewFootprintState.Previous = NewFootprintState.Current;
+	}
+
+	//Set New Current
+	NewFootprintState.Current.SurfaceType = NewSurfaceType;
+	EffectSettings->ApplyToFootprintPhase(NewFootprintState.Current);
+
+	ALSXTCharacter->ProcessNewFootprintsState(FootBone, NewFootprintsState);
+}
+
+void UALSXTAnimNotify_FootstepEffects::ScheduleEffects(USkeletalMeshComponent* Mesh, const FTransform& FootTransform, const FHitResult& Hit,
+	EALSXTEffectsSignificance Significance)
+{
+	FALSXTScheduledEffectRequest EffectRequest;
+	EffectRequest.Mesh = Mesh;
+	EffectRequest.Source = GetClass();
+	EffectRequest.Foot = FootBone;
+	EffectRequest.Location = FootTransform.GetLocation();
+
+	auto SpawnEffectsDelegate{
+		FALSXTScheduledEffectDelegate::CreateWeakLambda(this, [this, WeakMesh = TWeakObjectPtr<USkeletalMeshComponent>{Mesh}, FootTransform, Hit, Significance]
+		{
+			if (WeakMesh.IsValid())
+			{
+				SpawnEffects(WeakMesh.Get(), FootTransform, Hit, Significance);
+			}
+		})
+	};
+
+	UALSXTEffectsSchedulerSubsystem::ScheduleEffect(Mesh->GetWorld(), EffectRequest, MoveTemp(SpawnEffectsDelegate));
+}
+
+void UALSXTAnimNotify_FootstepEffects::SpawnEffects(USkeletalMeshComponent* Mesh, const FTransform& FootTransform, const FHitResult& Hit,
+	EALSXTEffectsSignificance Significance)
+{
+	if (!IsValid(FootstepEffectsSettings))
+	{
+		return;
+	}
+
+	AALSXTCharacter* ALSXTCharacter{Cast<AALSXTCharacter>(Mesh->GetOwner())};
+
+	const auto CapsuleScale{IsValid(ALSXTCharacter) ? ALSXTCharacter->GetCapsuleComponent()->GetComponentScale().Z : 1.0f};
+
+	auto* World{Mesh->GetWorld()};
+	const auto* AnimationInstance{Mesh->GetAnimInstance()};
+
+	const auto FootBoneName{FootBone == EALSXTFootBone::Left ? UAlsConstants::FootLeftBoneName() : UAlsConstants::FootRightBoneName()};
 
 #if ENABLE_DRAW_DEBUG
 	const auto bDisplayDebug{ UAlsUtility::ShouldDisplayDebugForActor(Mesh->GetOwner(), UAlsConstants::TracesDisplayName()) };
 #endif
 
-	FCollisionQueryParams QueryParameters{ ANSI_TO_TCHAR(__FUNCTION__), true, Mesh->GetOwner() };
-	QueryParameters.bReturnPhysicalMaterial = true;
+	HitResult = Hit;
 
-	if (World->LineTraceSingleByChannel(Hit, FootTransform.GetLocation(),
-		FootTransform.GetLocation() - FootZAxis *
-		(FootstepEffectsSettings->SurfaceTraceDistance * CapsuleScale),
-		UEngineTypes::ConvertToCollisionChannel(FootstepEffectsSettings->SurfaceTraceChannel),
-		QueryParameters))
+	if (Hit.bBlockingHit)
 	{
-		HitResult = Hit;
-		HitLocation = HitResult.ImpactPoint;
-		HitNormal = HitResult.ImpactNormal;
-		HitComponent = HitResult.Component;
-		HitPhysicalMaterial = HitResult.PhysMaterial;
-
 #if ENABLE_DRAW_DEBUG
 		if (bDisplayDebug)
 		{
@@ -110,32 +333,23 @@ void UALSXTAnimNotify_FootstepEffects::Notify(USkeletalMeshComponent* Mesh, UAni
 	else
 	{
 		HitResult.ImpactPoint = FootTransform.GetLocation();
-		Hit.ImpactPoint = FootTransform.GetLocation();
 		HitResult.ImpactNormal = FVector::UpVector;
-		Hit.ImpactNormal = FVector::UpVector;
-		HitLocation = FootTransform.GetLocation();
-		HitNormal = FVector::UpVector;
-		HitComponent = nullptr;
 		HitResult.Component = nullptr;
-		HitPhysicalMaterial = nullptr;
 		HitResult.PhysMaterial = nullptr;
 	}
 
 	const auto SurfaceType{ HitResult.PhysMaterial.IsValid() ? HitResult.PhysMaterial->SurfaceType.GetValue() : SurfaceType_Default };
-	const auto* EffectSettings{ FootstepEffectsSettings->Effects.Find(SurfaceType) };
-
-	if (EffectSettings == nullptr)
+	// Characters request the preload on begin play, this only covers meshes that are not driven by one.
+	if (!FootstepEffectsSettings->IsPreloadRequested() && !IsRunningDedicatedServer())
 	{
-		for (const auto& Pair : FootstepEffectsSettings->Effects)
-		{
-			EffectSettings = &Pair.Value;
-			break;
-		}
+		FootstepEffectsSettings->RequestPreload();
+	}
 
-		if (EffectSettings == nullptr)
-		{
-			return;
-		}
+	const auto* EffectSettings{ FootstepEffectsSettings->FindEffectSettings(SurfaceType) };
+
+	if (EffectSettings == nullptr || !UALSXTEffectsSignificanceSubsystem::ConsumeEffectBudget(World))
+	{
+		return;
 	}
 
 	const auto FootstepLocation{ HitResult.ImpactPoint };
@@ -155,7 +369,7 @@ void UALSXTAnimNotify_FootstepEffects::Notify(USkeletalMeshComponent* Mesh, UAni
 	}
 #endif
 
-	if (bSpawnSound)
+	if (bSpawnSound && UALSXTEffectsSignificanceSubsystem::IsSoundAllowed(Significance))
 	{
 		auto VolumeMultiplier{ SoundVolumeMultiplier };
 
@@ -164,9 +378,10 @@ void UALSXTAnimNotify_FootstepEffects::Notify(USkeletalMeshComponent* Mesh, UAni
 			VolumeMultiplier *= 1.0f - UAlsMath::Clamp01(AnimationInstance->GetCurveValue(UAlsConstants::FootstepSoundBlockCurveName()));
 		}
 
-		if (FAnimWeight::IsRelevant(VolumeMultiplier) && IsValid(EffectSettings->Sound.LoadSynchronous()))
+		if (FAnimWeight::IsRelevant(VolumeMultiplier) && IsValid(FALSXTEffectsPreloader::GetLoadedAsset(EffectSettings->Sound, World)))
 		{
 			UAudioComponent* Audio{ nullptr };
+			auto* AudioPool{World->GetSubsystem<UALSXTAudioEmitterSubsystem>()};
 
 			switch (EffectSettings->SoundSpawnType)
 			{
@@ -176,6 +391,12 @@ void UALSXTAnimNotify_FootstepEffects::Notify(USkeletalMeshComponent* Mesh, UAni
 					UGameplayStatics::PlaySoundAtLocation(World, EffectSettings->Sound.Get(), FootstepLocation,
 						VolumeMultiplier, SoundPitchMultiplier);
 				}
+				else if (IsValid(AudioPool))
+				{
+					Audio = AudioPool->PlaySoundAtLocation(EALSXTAudioEmitterCategory::Footstep, EffectSettings->Sound.Get(),
+						FootstepLocation, FootstepRotation.Rotator(),
+						VolumeMultiplier, SoundPitchMultiplier);
+				}
 				else
 				{
 					Audio = UGameplayStatics::SpawnSoundAtLocation(World, EffectSettings->Sound.Get(), FootstepLocation,
@@ -185,9 +406,17 @@ void UALSXTAnimNotify_FootstepEffects::Notify(USkeletalMeshComponent* Mesh, UAni
 				break;
 
 			case EALSXTFootstepSoundSpawnType::SpawnAttachedToFootBone:
-				Audio = UGameplayStatics::SpawnSoundAttached(EffectSettings->Sound.Get(), Mesh, FootBoneName, FVector::ZeroVector,
-					FRotator::ZeroRotator, EAttachLocation::SnapToTarget,
-					true, VolumeMultiplier, SoundPitchMultiplier);
+				if (IsValid(AudioPool))
+				{
+					Audio = AudioPool->PlaySoundAttached(EALSXTAudioEmitterCategory::Footstep, EffectSettings->Sound.Get(),
+						Mesh, FootBoneName, VolumeMultiplier, SoundPitchMultiplier);
+				}
+				else
+				{
+					Audio = UGameplayStatics::SpawnSoundAttached(EffectSettings->Sound.Get(), Mesh, FootBoneName, FVector::ZeroVector,
+						FRotator::ZeroRotator, EAttachLocation::SnapToTarget,
+						true, VolumeMultiplier, SoundPitchMultiplier);
+				}
 				break;
 			}
 
@@ -198,7 +427,8 @@ void UALSXTAnimNotify_FootstepEffects::Notify(USkeletalMeshComponent* Mesh, UAni
 		}
 	}
 
-	if (bSpawnDecal && IsValid(EffectSettings->DecalMaterial.LoadSynchronous()))
+	if (bSpawnDecal && UALSXTEffectsSignificanceSubsystem::IsDecalAllowed(Significance) &&
+	    IsValid(FALSXTEffectsPreloader::GetLoadedAsset(EffectSettings->DecalMaterial, World)))
 	{
 		const auto DecalRotation{
 			FootstepRotation * (FootBone == EALSXTFootBone::Left
@@ -210,9 +440,19 @@ void UALSXTAnimNotify_FootstepEffects::Notify(USkeletalMeshComponent* Mesh, UAni
 			FootstepLocation + DecalRotation.RotateVector(EffectSettings->DecalLocationOffset * CapsuleScale)
 		};
 
+		const auto bAttachDecal{
+			EffectSettings->DecalSpawnType == EALSXTFootstepDecalSpawnType::SpawnAttachedToTraceHitComponent && HitResult.Component.IsValid()
+		};
+
+		auto* DecalPool{World->GetSubsystem<UALSXTFootprintDecalSubsystem>()};
 		UDecalComponent* Decal;
 
-		if (EffectSettings->DecalSpawnType == EALSXTFootstepDecalSpawnType::SpawnAttachedToTraceHitComponent && HitResult.Component.IsValid())
+		if (IsValid(DecalPool))
+		{
+			Decal = DecalPool->AcquireDecal(EffectSettings->DecalMaterial.Get(), EffectSettings->DecalSize * CapsuleScale,
+				DecalLocation, DecalRotation.Rotator(), bAttachDecal ? HitResult.Component.Get() : nullptr);
+		}
+		else if (bAttachDecal)
 		{
 			Decal = UGameplayStatics::SpawnDecalAttached(EffectSettings->DecalMaterial.Get(), EffectSettings->DecalSize * CapsuleScale,
 				HitResult.Component.Get(), NAME_None, DecalLocation,
@@ -229,222 +469,71 @@ void UALSXTAnimNotify_FootstepEffects::Notify(USkeletalMeshComponent* Mesh, UAni
 		{
 			if (IsValid(ALSXTCharacter)) {
 
+				const auto NewSurfaceType{UGameplayStatics::GetSurfaceType(Hit)};
+
+				// The footprints state was already updated for this step when the surface was probed.
 				CurrentFootprintsState = ALSXTCharacter->GetFootprintsState();
 
-				// Declare local variables
-				UMaterialInstanceDynamic* MI;
-				float CalculatedSoleNormalScale{ 0.0f };
-				float CalculatedTransferNormalScale{ 0.0f };
-				float DurationAverage{ 0.0f };
-				FVector2D InputRange{ 0, 1 };
-				FVector2D OutputRange{ 0, 1 };
-				float DurationModifier{ 0.0f };
-
-				// Set New Left or Right foot Values based on current FootBone
-				if (FootBone == EALSXTFootBone::Left) {
-
-					NewSurface = ((UGameplayStatics::GetSurfaceType(Hit) != CurrentFootprintsState.Left.Current.SurfaceType));
-
-					if (NewSurface) {
-
-						//Set Current as Previous
-						CurrentFootprintsState.Left.Previous = ALSXTCharacter->GetFootprintsState().Left.Current;
-
-						//Set New Current
-						CurrentFootprintsState.Left.Current.SurfaceType = UGameplayStatics::GetSurfaceType(Hit);
-						CurrentFootprintsState.Left.Current.TransferDetailTexture = EffectSettings->TransferDetailTexture;
-						CurrentFootprintsState.Left.Current.TransferDetailScale = EffectSettings->TransferDetailTextureScale;
-						CurrentFootprintsState.Left.Current.TransferPrimaryColor = EffectSettings->TransferPrimaryColor;
-						CurrentFootprintsState.Left.Current.TransferSecondaryColor = EffectSettings->TransferSecondaryColor;
-						CurrentFootprintsState.Left.Current.TransferWetness = EffectSettings->TransferWetness;
-						CurrentFootprintsState.Left.Current.TransferSaturationRate = EffectSettings->TransferSaturationRate;
-						CurrentFootprintsState.Left.Current.TransferDesaturationRate = EffectSettings->TransferDesaturationRate;
-						CurrentFootprintsState.Left.Current.TransferEmissiveAmount = EffectSettings->TransferEmissive;
-						CurrentFootprintsState.Left.Current.DecalDuration = EffectSettings->DecalDuration;
-						CurrentFootprintsState.Left.Current.DecalFadeOutDuration = EffectSettings->DecalFadeOutDuration;
-						CurrentFootprintsState.Left.Current.DecalDurationModifierMin = EffectSettings->DecalDurationModifierMin;
-						CurrentFootprintsState.Left.Current.DecalDurationModifierMax = EffectSettings->DecalDurationModifierMax;
-						CurrentFootprintsState.Left.Current.SurfaceTransferAcceptanceAmount = EffectSettings->SurfaceTransferAcceptanceAmount;
-						CurrentFootprintsState.Left.Current.TransferDetailScale = EffectSettings->TransferDetailScale;
-						CurrentFootprintsState.Left.Current.TransferAmount = EffectSettings->TransferAmount;
-						CurrentFootprintsState.Left.Current.SurfaceTransferAmount = EffectSettings->SurfaceTransferAmount;
-						CurrentFootprintsState.Left.Current.TransferNormalScale = EffectSettings->TransferNormalScale;
-						CurrentFootprintsState.Left.Current.TransferGrainSize = EffectSettings->TransferGrainSize;
-						CurrentFootprintsState.Left.Current.SurfaceTransferAcceptanceNormalScale = EffectSettings->SurfaceTransferAcceptanceNormalScale;
-						CurrentFootprintsState.Left.Current.TransferDetailNormalAmount = EffectSettings->TransferDetailNormalAmount;
-					}
-					else {
-						//Set New Current
-						CurrentFootprintsState.Left.Current.SurfaceType = UGameplayStatics::GetSurfaceType(Hit);
-						CurrentFootprintsState.Left.Current.TransferDetailTexture = EffectSettings->TransferDetailTexture;
-						CurrentFootprintsState.Left.Current.TransferDetailScale = EffectSettings->TransferDetailTextureScale;
-						CurrentFootprintsState.Left.Current.TransferPrimaryColor = EffectSettings->TransferPrimaryColor;
-						CurrentFootprintsState.Left.Current.TransferSecondaryColor = EffectSettings->TransferSecondaryColor;
-						CurrentFootprintsState.Left.Current.TransferWetness = EffectSettings->TransferWetness;
-						CurrentFootprintsState.Left.Current.TransferSaturationRate = EffectSettings->TransferSaturationRate;
-						CurrentFootprintsState.Left.Current.TransferDesaturationRate = EffectSettings->TransferDesaturationRate;
-						CurrentFootprintsState.Left.Current.TransferEmissiveAmount = EffectSettings->TransferEmissive;
-						CurrentFootprintsState.Left.Current.DecalDuration = EffectSettings->DecalDuration;
-						CurrentFootprintsState.Left.Current.DecalFadeOutDuration = EffectSettings->DecalFadeOutDuration;
-						CurrentFootprintsState.Left.Current.DecalDurationModifierMin = EffectSettings->DecalDurationModifierMin;
-						CurrentFootprintsState.Left.Current.DecalDurationModifierMax = EffectSettings->DecalDurationModifierMax;
-						CurrentFootprintsState.Left.Current.SurfaceTransferAcceptanceAmount = EffectSettings->SurfaceTransferAcceptanceAmount;
-						CurrentFootprintsState.Left.Current.TransferDetailScale = EffectSettings->TransferDetailScale;
-						CurrentFootprintsState.Left.Current.TransferAmount = EffectSettings->TransferAmount;
-						CurrentFootprintsState.Left.Current.SurfaceTransferAmount = EffectSettings->SurfaceTransferAmount;
-						CurrentFootprintsState.Left.Current.TransferNormalScale = EffectSettings->TransferNormalScale;
-						CurrentFootprintsState.Left.Current.TransferGrainSize = EffectSettings->TransferGrainSize;
-						CurrentFootprintsState.Left.Current.SurfaceTransferAcceptanceNormalScale = EffectSettings->SurfaceTransferAcceptanceNormalScale;
-						CurrentFootprintsState.Left.Current.TransferDetailNormalAmount = EffectSettings->TransferDetailNormalAmount;
-					}
-					CalculatedSoleNormalScale = (EffectSettings->TransferNormalScale + EffectSettings->SurfaceTransferAcceptanceNormalScale) * EffectSettings->SurfaceTransferAmount * EffectSettings->SurfaceTransferAcceptanceAmount;
-					ALSXTCharacter->ProcessNewFootprintsState(EALSXTFootBone::Left, CurrentFootprintsState);
-					CurrentFootprintsState = ALSXTCharacter->GetFootprintsState();
-
-					
-					//Create Dynamic Material Instance and Set Parameters
-					MI = UMaterialInstanceDynamic::Create(Decal->GetMaterial(0), this);
-					Decal->SetMaterial(0, MI);
-
-					MI->SetTextureParameterValue(FName("SoleTexture"), ALSXTCharacter->GetFootwearDetails().FootwearSoleTexture);
-					MI->SetTextureParameterValue(FName("SoleNormal"), ALSXTCharacter->GetFootwearDetails().FootwearSoleNormalTexture);
-					MI->SetTextureParameterValue(FName("SoleDetail"), ALSXTCharacter->GetFootwearDetails().FootwearSoleDetailTexture);
-					MI->SetScalarParameterValue(FName("SoleNormalScale"), CalculatedSoleNormalScale);
-					MI->SetTextureParameterValue(FName("TransferDetailTexture"), ALSXTCharacter->GetFootprintsState().Left.Current.TransferDetailTexture);
-					MI->SetTextureParameterValue(FName("TransferDetailNormal"), ALSXTCharacter->GetFootprintsState().Left.Current.TransferDetailNormal);
-					MI->SetScalarParameterValue(FName("TransferNormalScale"), ALSXTCharacter->GetFootprintsState().Left.Current.TransferNormalScale * EffectSettings->SurfaceTransferAcceptanceAmount);
-					MI->SetScalarParameterValue(FName("TransferDetailScale"), ALSXTCharacter->GetFootprintsState().Left.Current.TransferDetailScale);
-					MI->SetScalarParameterValue(FName("Opacity"), EffectSettings->SurfaceTransferAcceptanceAmount);
-					MI->SetVectorParameterValue(FName("PrimaryColor"), ALSXTCharacter->GetFootprintsState().Left.Current.TransferPrimaryColor);
-					MI->SetVectorParameterValue(FName("SecondaryColor"), ALSXTCharacter->GetFootprintsState().Left.Current.TransferSecondaryColor);
-					MI->SetScalarParameterValue(FName("GrainSize"), ALSXTCharacter->GetFootprintsState().Left.Current.TransferGrainSize);
-					MI->SetScalarParameterValue(FName("Wetness"), ALSXTCharacter->GetFootprintsState().Left.Current.TransferWetness * EffectSettings->SurfaceTransferAcceptanceAmount);
-					MI->SetScalarParameterValue(FName("EmissiveAmount"), ALSXTCharacter->GetFootprintsState().Left.Current.TransferEmissiveAmount * EffectSettings->SurfaceTransferAcceptanceAmount);
-					MI->SetTextureParameterValue(FName("TransferDetailTexturePrevious"), ALSXTCharacter->GetFootprintsState().Left.Previous.TransferDetailTexture);
-					MI->SetTextureParameterValue(FName("TransferDetailNormalPrevious"), ALSXTCharacter->GetFootprintsState().Left.Previous.TransferDetailNormal);
-					MI->SetScalarParameterValue(FName("TransferNormalScalePrevious"), ALSXTCharacter->GetFootprintsState().Left.Previous.TransferNormalScale* EffectSettings->SurfaceTransferAcceptanceAmount);
-					MI->SetScalarParameterValue(FName("TransferDetailScalePrevious"), ALSXTCharacter->GetFootprintsState().Left.Previous.TransferDetailScale);
-					MI->SetVectorParameterValue(FName("PrimaryColorPrevious"), ALSXTCharacter->GetFootprintsState().Left.Previous.TransferPrimaryColor);
-					MI->SetVectorParameterValue(FName("SecondaryColorPrevious"), ALSXTCharacter->GetFootprintsState().Left.Previous.TransferSecondaryColor);
-					MI->SetScalarParameterValue(FName("GrainSizePrevious"), ALSXTCharacter->GetFootprintsState().Left.Previous.TransferGrainSize);
-					MI->SetScalarParameterValue(FName("WetnessPrevious"), ALSXTCharacter->GetFootprintsState().Left.Previous.TransferWetness * EffectSettings->SurfaceTransferAcceptanceAmount);
-					MI->SetScalarParameterValue(FName("EmissiveAmountPrevious"), ALSXTCharacter->GetFootprintsState().Left.Previous.TransferEmissiveAmount * EffectSettings->SurfaceTransferAcceptanceAmount);
-					MI->SetScalarParameterValue(FName("PhaseAlpha"), ALSXTCharacter->GetFootprintsState().Left.FootSurfaceAlpha);
-					MI->SetScalarParameterValue(FName("TransferAmount"), ALSXTCharacter->GetFootprintsState().Left.Current.TransferAmount * EffectSettings->SurfaceTransferAcceptanceAmount);
-					MI->SetScalarParameterValue(FName("SurfaceTransferAmount"), ALSXTCharacter->GetFootprintsState().Left.Current.SurfaceTransferAmount * EffectSettings->SurfaceTransferAcceptanceAmount);
-					MI->SetScalarParameterValue(FName("TransferAmountPrevious"), ALSXTCharacter->GetFootprintsState().Left.Previous.TransferAmount * EffectSettings->SurfaceTransferAcceptanceAmount);
-					MI->SetScalarParameterValue(FName("SurfaceTransferAmountPrevious"), ALSXTCharacter->GetFootprintsState().Left.Previous.SurfaceTransferAmount * EffectSettings->SurfaceTransferAcceptanceAmount);
-
-					//Calculate Duration based on Materials. Wetter materials stay longer
-					DurationAverage = ALSXTCharacter->GetFootprintsState().Left.Current.TransferWetness + EffectSettings->SurfaceTransferAmount / 2;
-					InputRange = { 0, 1 };
-					OutputRange = { EffectSettings->DecalDurationModifierMin, EffectSettings->DecalDurationModifierMax };
-					DurationModifier = FMath::GetMappedRangeValueClamped(InputRange, OutputRange, DurationAverage);
-					Decal->SetFadeOut(EffectSettings->DecalDuration, EffectSettings->DecalFadeOutDuration* DurationModifier, false);
+				const auto& FootprintState{FootBone == EALSXTFootBone::Left ? CurrentFootprintsState.Left : CurrentFootprintsState.Right};
+				const auto FootwearDetails{ALSXTCharacter->GetFootwearDetails()};
+				const auto AcceptanceAmount{EffectSettings->SurfaceTransferAcceptanceAmount};
+
+				// Set Material Parameters. Only the values that changed since the previous footprint on this surface reach the material
+				FALSXTFootprintMaterialParameters MaterialParameters;
+
+				MaterialParameters.SetTexture(EALSXTFootprintTextureParameter::SoleTexture, FootwearDetails.FootwearSoleTexture);
+				MaterialParameters.SetTexture(EALSXTFootprintTextureParameter::SoleNormal, FootwearDetails.FootwearSoleNormalTexture);
+				MaterialParameters.SetTexture(EALSXTFootprintTextureParameter::SoleDetail, FootwearDetails.FootwearSoleDetailTexture);
+				MaterialParameters.SetScalar(EALSXTFootprintScalarParameter::SoleNormalScale,
+					(EffectSettings->TransferNormalScale + EffectSettings->SurfaceTransferAcceptanceNormalScale) * EffectSettings->SurfaceTransferAmount * AcceptanceAmount);
+
+				MaterialParameters.SetTexture(EALSXTFootprintTextureParameter::TransferDetailTexture, FootprintState.Current.TransferDetailTexture);
+				MaterialParameters.SetTexture(EALSXTFootprintTextureParameter::TransferDetailNormal, FootprintState.Current.TransferDetailNormal);
+				MaterialParameters.SetScalar(EALSXTFootprintScalarParameter::TransferNormalScale, FootprintState.Current.TransferNormalScale * AcceptanceAmount);
+				MaterialParameters.SetScalar(EALSXTFootprintScalarParameter::TransferDetailScale, FootprintState.Current.TransferDetailScale);
+				MaterialParameters.SetScalar(EALSXTFootprintScalarParameter::Opacity, AcceptanceAmount);
+				MaterialParameters.SetVector(EALSXTFootprintVectorParameter::PrimaryColor, FootprintState.Current.TransferPrimaryColor);
+				MaterialParameters.SetVector(EALSXTFootprintVectorParameter::SecondaryColor, FootprintState.Current.TransferSecondaryColor);
+				MaterialParameters.SetScalar(EALSXTFootprintScalarParameter::GrainSize, FootprintState.Current.TransferGrainSize);
+				MaterialParameters.SetScalar(EALSXTFootprintScalarParameter::Wetness, FootprintState.Current.TransferWetness * AcceptanceAmount);
+				MaterialParameters.SetScalar(EALSXTFootprintScalarParameter::EmissiveAmount, FootprintState.Current.TransferEmissiveAmount * AcceptanceAmount);
+
+				MaterialParameters.SetTexture(EALSXTFootprintTextureParameter::TransferDetailTexturePrevious, FootprintState.Previous.TransferDetailTexture);
+				MaterialParameters.SetTexture(EALSXTFootprintTextureParameter::TransferDetailNormalPrevious, FootprintState.Previous.TransferDetailNormal);
+				MaterialParameters.SetScalar(EALSXTFootprintScalarParameter::TransferNormalScalePrevious, FootprintState.Previous.TransferNormalScale * AcceptanceAmount);
+				MaterialParameters.SetScalar(EALSXTFootprintScalarParameter::TransferDetailScalePrevious, FootprintState.Previous.TransferDetailScale);
+				MaterialParameters.SetVector(EALSXTFootprintVectorParameter::PrimaryColorPrevious, FootprintState.Previous.TransferPrimaryColor);
+				MaterialParameters.SetVector(EALSXTFootprintVectorParameter::SecondaryColorPrevious, FootprintState.Previous.TransferSecondaryColor);
+				MaterialParameters.SetScalar(EALSXTFootprintScalarParameter::GrainSizePrevious, FootprintState.Previous.TransferGrainSize);
+				MaterialParameters.SetScalar(EALSXTFootprintScalarParameter::WetnessPrevious, FootprintState.Previous.TransferWetness * AcceptanceAmount);
+				MaterialParameters.SetScalar(EALSXTFootprintScalarParameter::EmissiveAmountPrevious, FootprintState.Previous.TransferEmissiveAmount * AcceptanceAmount);
+
+				MaterialParameters.SetScalar(EALSXTFootprintScalarParameter::PhaseAlpha, FootprintState.FootSurfaceAlpha);
+				MaterialParameters.SetScalar(EALSXTFootprintScalarParameter::TransferAmount, FootprintState.Current.TransferAmount * AcceptanceAmount);
+				MaterialParameters.SetScalar(EALSXTFootprintScalarParameter::SurfaceTransferAmount, FootprintState.Current.SurfaceTransferAmount * AcceptanceAmount);
+				MaterialParameters.SetScalar(EALSXTFootprintScalarParameter::TransferAmountPrevious, FootprintState.Previous.TransferAmount * AcceptanceAmount);
+				MaterialParameters.SetScalar(EALSXTFootprintScalarParameter::SurfaceTransferAmountPrevious, FootprintState.Previous.SurfaceTransferAmount * AcceptanceAmount);
+
+				auto* MI{
+					ALSXTCharacter->GetFootprintMaterialCache().GetMaterial(ALSXTCharacter, EffectSettings->DecalMaterial.Get(),
+						FootBone, NewSurfaceType, MaterialParameters)
+				};
+
+				Decal->SetMaterial(0, MI);
+
+				//Calculate Duration based on Materials. Wetter materials stay longer
+				const auto DurationAverage{FootprintState.Current.TransferWetness + EffectSettings->SurfaceTransferAmount / 2};
+				const FVector2D InputRange{0, 1};
+				const FVector2D OutputRange{EffectSettings->DecalDurationModifierMin, EffectSettings->DecalDurationModifierMax};
+				const auto DurationModifier{FMath::GetMappedRangeValueClamped(InputRange, OutputRange, DurationAverage)};
+
+				if (IsValid(DecalPool))
+				{
+					DecalPool->SetDecalFadeOut(Decal, EffectSettings->DecalDuration, EffectSettings->DecalFadeOutDuration * DurationModifier);
 				}
-				if (FootBone == EALSXTFootBone::Right) {
-
-					NewSurface = ((UGameplayStatics::GetSurfaceType(Hit) != CurrentFootprintsState.Right.Current.SurfaceType));
-
-					if (NewSurface) {
-
-						//Set Current as Previous
-
-						CurrentFootprintsState.Right.Previous = ALSXTCharacter->GetFootprintsState().Right.Current;
-
-						// CurrentFootprintsState.Right.Previous.TransferSaturationRate = ALSXTCharacter->GetFootprintsState().Right.Current.TransferSaturationRate;
-
-						//Set New Current
-						CurrentFootprintsState.Right.Current.SurfaceType = UGameplayStatics::GetSurfaceType(Hit);
-						CurrentFootprintsState.Right.Current.TransferDetailTexture = EffectSettings->TransferDetailTexture;
-						CurrentFootprintsState.Right.Current.TransferDetailScale = EffectSettings->TransferDetailTextureScale;
-						CurrentFootprintsState.Right.Current.TransferPrimaryColor = EffectSettings->TransferPrimaryColor;
-						CurrentFootprintsState.Right.Current.TransferSecondaryColor = EffectSettings->TransferSecondaryColor;
-						CurrentFootprintsState.Right.Current.TransferWetness = EffectSettings->TransferWetness;
-						CurrentFootprintsState.Right.Current.TransferSaturationRate = EffectSettings->TransferSaturationRate;
-						CurrentFootprintsState.Right.Current.TransferDesaturationRate = EffectSettings->TransferDesaturationRate;
-						CurrentFootprintsState.Right.Current.TransferEmissiveAmount = EffectSettings->TransferEmissive;
-						CurrentFootprintsState.Right.Current.DecalDuration = EffectSettings->DecalDuration;
-						CurrentFootprintsState.Right.Current.DecalFadeOutDuration = EffectSettings->DecalFadeOutDuration;
-						CurrentFootprintsState.Right.Current.DecalDurationModifierMin = EffectSettings->DecalDurationModifierMin;
-						CurrentFootprintsState.Right.Current.DecalDurationModifierMax = EffectSettings->DecalDurationModifierMax;
-						CurrentFootprintsState.Right.Current.SurfaceTransferAcceptanceAmount = EffectSettings->SurfaceTransferAcceptanceAmount;
-						CurrentFootprintsState.Right.Current.TransferDetailScale = EffectSettings->TransferDetailScale;
-						CurrentFootprintsState.Right.Current.TransferAmount = EffectSettings->TransferAmount;
-						CurrentFootprintsState.Right.Current.SurfaceTransferAmount = EffectSettings->SurfaceTransferAmount;
-						CurrentFootprintsState.Right.Current.TransferNormalScale = EffectSettings->TransferNormalScale;
-						CurrentFootprintsState.Right.Current.TransferGrainSize = EffectSettings->TransferGrainSize;
-						CurrentFootprintsState.Right.Current.SurfaceTransferAcceptanceNormalScale = EffectSettings->SurfaceTransferAcceptanceNormalScale;
-						CurrentFootprintsState.Right.Current.TransferDetailNormalAmount = EffectSettings->TransferDetailNormalAmount;
-					}
-					else {
-						//Set New Current
-						CurrentFootprintsState.Right.Current.SurfaceType = UGameplayStatics::GetSurfaceType(Hit);
-						CurrentFootprintsState.Right.Current.TransferDetailTexture = EffectSettings->TransferDetailTexture;
-						CurrentFootprintsState.Right.Current.TransferDetailScale = EffectSettings->TransferDetailTextureScale;
-						CurrentFootprintsState.Right.Current.TransferPrimaryColor = EffectSettings->TransferPrimaryColor;
-						CurrentFootprintsState.Right.Current.TransferSecondaryColor = EffectSettings->TransferSecondaryColor;
-						CurrentFootprintsState.Right.Current.TransferWetness = EffectSettings->TransferWetness;
-						CurrentFootprintsState.Right.Current.TransferSaturationRate = EffectSettings->TransferSaturationRate;
-						CurrentFootprintsState.Right.Current.TransferDesaturationRate = EffectSettings->TransferDesaturationRate;
-						CurrentFootprintsState.Right.Current.TransferEmissiveAmount = EffectSettings->TransferEmissive;
-						CurrentFootprintsState.Right.Current.DecalDuration = EffectSettings->DecalDuration;
-						CurrentFootprintsState.Right.Current.DecalFadeOutDuration = EffectSettings->DecalFadeOutDuration;
-						CurrentFootprintsState.Right.Current.DecalDurationModifierMin = EffectSettings->DecalDurationModifierMin;
-						CurrentFootprintsState.Right.Current.DecalDurationModifierMax = EffectSettings->DecalDurationModifierMax;
-						CurrentFootprintsState.Right.Current.SurfaceTransferAcceptanceAmount = EffectSettings->SurfaceTransferAcceptanceAmount;
-						CurrentFootprintsState.Right.Current.TransferDetailScale = EffectSettings->SurfaceTransferAcceptanceNormalScale;
-						CurrentFootprintsState.Right.Current.TransferDetailScale = EffectSettings->TransferDetailScale;
-						CurrentFootprintsState.Right.Current.TransferAmount = EffectSettings->TransferAmount;
-						CurrentFootprintsState.Right.Current.SurfaceTransferAmount = EffectSettings->SurfaceTransferAmount;
-						CurrentFootprintsState.Right.Current.TransferNormalScale = EffectSettings->TransferNormalScale;
-						CurrentFootprintsState.Right.Current.TransferGrainSize = EffectSettings->TransferGrainSize;
-						CurrentFootprintsState.Right.Current.SurfaceTransferAcceptanceNormalScale = EffectSettings->SurfaceTransferAcceptanceNormalScale;
-						CurrentFootprintsState.Right.Current.TransferDetailNormalAmount = EffectSettings->TransferDetailNormalAmount;
-					}
-					CalculatedSoleNormalScale = (EffectSettings->TransferNormalScale + EffectSettings->SurfaceTransferAcceptanceNormalScale) * EffectSettings->SurfaceTransferAmount * EffectSettings->SurfaceTransferAcceptanceAmount;
-					ALSXTCharacter->ProcessNewFootprintsState(EALSXTFootBone::Right, CurrentFootprintsState);
-					CurrentFootprintsState = ALSXTCharacter->GetFootprintsState();
-
-					//Create Dynamic Material Instance and Set Parameters
-					MI = UMaterialInstanceDynamic::Create(Decal->GetMaterial(0), this);
-					Decal->SetMaterial(0, MI);
-
-					MI->SetTextureParameterValue(FName("SoleTexture"), ALSXTCharacter->GetFootwearDetails().FootwearSoleTexture);
-					MI->SetTextureParameterValue(FName("SoleNormal"), ALSXTCharacter->GetFootwearDetails().FootwearSoleNormalTexture);
-					MI->SetTextureParameterValue(FName("SoleDetail"), ALSXTCharacter->GetFootwearDetails().FootwearSoleDetailTexture);
-					MI->SetScalarParameterValue(FName("SoleNormalScale"), CalculatedSoleNormalScale);
-					MI->SetTextureParameterValue(FName("TransferDetailTexture"), ALSXTCharacter->GetFootprintsState().Right.Current.TransferDetailTexture);
-					MI->SetTextureParameterValue(FName("TransferDetailNormal"), ALSXTCharacter->GetFootprintsState().Right.Current.TransferDetailNormal);
-					MI->SetScalarParameterValue(FName("TransferNormalScale"), ALSXTCharacter->GetFootprintsState().Right.Current.TransferNormalScale * EffectSettings->SurfaceTransferAcceptanceAmount);
-					MI->SetScalarParameterValue(FName("TransferDetailScale"), ALSXTCharacter->GetFootprintsState().Right.Current.TransferDetailScale);
-					MI->SetScalarParameterValue(FName("Opacity"), EffectSettings->SurfaceTransferAcceptanceAmount);
-					MI->SetVectorParameterValue(FName("PrimaryColor"), ALSXTCharacter->GetFootprintsState().Right.Current.TransferPrimaryColor);
-					MI->SetVectorParameterValue(FName("SecondaryColor"), ALSXTCharacter->GetFootprintsState().Right.Current.TransferSecondaryColor);
-					MI->SetScalarParameterValue(FName("GrainSize"), ALSXTCharacter->GetFootprintsState().Right.Current.TransferGrainSize);
-					MI->SetScalarParameterValue(FName("Wetness"), ALSXTCharacter->GetFootprintsState().Right.Current.TransferWetness * EffectSettings->SurfaceTransferAcceptanceAmount);
-					MI->SetScalarParameterValue(FName("EmissiveAmount"), ALSXTCharacter->GetFootprintsState().Right.Current.TransferEmissiveAmount * EffectSettings->SurfaceTransferAcceptanceAmount);
-					MI->SetTextureParameterValue(FName("TransferDetailTexturePrevious"), ALSXTCharacter->GetFootprintsState().Right.Previous.TransferDetailTexture);
-					MI->SetTextureParameterValue(FName("TransferDetailNormalPrevious"), ALSXTCharacter->GetFootprintsState().Right.Previous.TransferDetailNormal);
-					MI->SetScalarParameterValue(FName("TransferNormalScalePrevious"), ALSXTCharacter->GetFootprintsState().Right.Previous.TransferNormalScale);
-					MI->SetScalarParameterValue(FName("TransferDetailScalePrevious"), ALSXTCharacter->GetFootprintsState().Right.Previous.TransferDetailScale);
-					MI->SetVectorParameterValue(FName("PrimaryColorPrevious"), ALSXTCharacter->GetFootprintsState().Right.Previous.TransferPrimaryColor);
-					MI->SetVectorParameterValue(FName("SecondaryColorPrevious"), ALSXTCharacter->GetFootprintsState().Right.Previous.TransferSecondaryColor);
-					MI->SetScalarParameterValue(FName("GrainSizePrevious"), ALSXTCharacter->GetFootprintsState().Right.Previous.TransferGrainSize);
-					MI->SetScalarParameterValue(FName("WetnessPrevious"), ALSXTCharacter->GetFootprintsState().Right.Previous.TransferWetness * EffectSettings->SurfaceTransferAcceptanceAmount);
-					MI->SetScalarParameterValue(FName("EmissiveAmountPrevious"), ALSXTCharacter->GetFootprintsState().Right.Previous.TransferEmissiveAmount * EffectSettings->SurfaceTransferAcceptanceAmount);
-					MI->SetScalarParameterValue(FName("PhaseAlpha"), ALSXTCharacter->GetFootprintsState().Right.FootSurfaceAlpha);
-					MI->SetScalarParameterValue(FName("TransferAmount"), ALSXTCharacter->GetFootprintsState().Right.Current.TransferAmount * EffectSettings->SurfaceTransferAcceptanceAmount);
-					MI->SetScalarParameterValue(FName("SurfaceTransferAmount"), ALSXTCharacter->GetFootprintsState().Right.Current.SurfaceTransferAmount * EffectSettings->SurfaceTransferAcceptanceAmount);
-					MI->SetScalarParameterValue(FName("TransferAmountPrevious"), ALSXTCharacter->GetFootprintsState().Right.Previous.TransferAmount * EffectSettings->SurfaceTransferAcceptanceAmount);
-					MI->SetScalarParameterValue(FName("SurfaceTransferAmountPrevious"), ALSXTCharacter->GetFootprintsState().Right.Previous.SurfaceTransferAmount * EffectSettings->SurfaceTransferAcceptanceAmount);
-
-					//Calculate Duration based on Materials. Wetter materials stay longer
-					DurationAverage = ALSXTCharacter->GetFootprintsState().Right.Current.TransferWetness + EffectSettings->SurfaceTransferAmount / 2;
-					InputRange = { 0, 1 };
-					OutputRange = { EffectSettings->DecalDurationModifierMin, EffectSettings->DecalDurationModifierMax };
-					DurationModifier = FMath::GetMappedRangeValueClamped(InputRange, OutputRange, DurationAverage);
-					Decal->SetFadeOut(EffectSettings->DecalDuration, EffectSettings->DecalFadeOutDuration * DurationModifier, false);	
+				else
+				{
+					Decal->SetFadeOut(EffectSettings->DecalDuration, EffectSettings->DecalFadeOutDuration * DurationModifier, false);
 				}
 			}
 			else
@@ -455,7 +544,8 @@ void UALSXTAnimNotify_FootstepEffects::Notify(USkeletalMeshComponent* Mesh, UAni
 		}
 	}
 
-	if (bSpawnParticleSystem && IsValid(EffectSettings->ParticleSystem.LoadSynchronous()) && IsValid(EffectSettings->FootstepParticles.WalkParticleSystem.LoadSynchronous()) && IsValid(EffectSettings->FootstepParticles.RunParticleSystem.LoadSynchronous()) && IsValid(EffectSettings->FootstepParticles.LandParticleSystem.LoadSynchronous()))
+	if (bSpawnParticleSystem && UALSXTEffectsSignificanceSubsystem::IsParticleSystemAllowed(Significance) &&
+	    IsValid(FALSXTEffectsPreloader::GetLoadedAsset(EffectSettings->ParticleSystem, World)) && IsValid(FALSXTEffectsPreloader::GetLoadedAsset(EffectSettings->FootstepParticles.WalkParticleSystem, World)) && IsValid(FALSXTEffectsPreloader::GetLoadedAsset(EffectSettings->FootstepParticles.RunParticleSystem, World)) && IsValid(FALSXTEffectsPreloader::GetLoadedAsset(EffectSettings->FootstepParticles.LandParticleSystem, World)))
 	{
 		UNiagaraSystem* GaitParticleSystem;
 		if (IsValid(ALSXTCharacter)) {
@@ -16,12 +16,77 @@
 #include "Kismet/GameplayStatics.h"
 #include "Notify/ALSXTAnimNotify_FootstepEffects.h"
 #include "PhysicalMaterials/PhysicalMaterial.h"
+#include "Subsystems/ALSXTAudioEmitterSubsystem.h"
+#include "Subsystems/ALSXTEffectsSchedulerSubsystem.h"
+#include "Subsystems/ALSXTEffectsSignificanceSubsystem.h"
+#include "Subsystems/ALSXTFootSurfaceProbeSubsystem.h"
 #include "Utility/AlsConstants.h"
 #include "Utility/AlsEnumUtility.h"
 #include "Utility/AlsMacros.h"
 #include "Utility/AlsMath.h"
 #include "Utility/AlsUtility.h"
 
+void UALSXTSlideEffectsSettings::PostLoad()
+{
+	Super::PostLoad();
+
+	CompileEffects();
+}
+
+void UALSXTSlideEffectsSettings::BeginDestroy()
+{
+	Preloader.Release();
+
+	Super::BeginDestroy();
+}
+
+#if WITH_EDITOR
+void UALSXTSlideEffectsSettings::PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent)
+{
+	Super::PostEditChangeProperty(PropertyChangedEvent);
+
+	CompileEffects();
+
+	if (Preloader.IsRequested())
+	{
+		RequestPreload();
+	}
+}
+#endif
+
+void UALSXTSlideEffectsSettings::CompileEffects()
+{
+	EffectTable.Compile(Effects);
+}
+
+const FALSXTSlideEffectSettings* UALSXTSlideEffectsSettings::FindEffectSettings(const EPhysicalSurface SurfaceType) const
+{
+	if (!EffectTable.IsCompiled())
+	{
+		EffectTable.Compile(Effects);
+	}
+
+	return EffectTable.Find(SurfaceType);
+}
+
+void UALSXTSlideEffectsSettings::RequestPreload()
+{
+	TArray<FSoftObjectPath> AssetPaths;
+
+	for (const auto& Pair : Effects)
+	{
+		AssetPaths.Add(Pair.Value.Sound.ToSoftObjectPath());
+		AssetPaths.Add(Pair.Value.ParticleSystem.ToSoftObjectPath());
+	}
+
+	Preloader.Request(MoveTemp(AssetPaths), GetName());
+}
+
+FALSXTEffectsPreloadInfo UALSXTSlideEffectsSettings::GetPreloadInfo() const
+{
+	return Preloader.GetInfo();
+}
+
 FString UALSXTAnimNotify_SlideEffects::GetNotifyName_Implementation() const
 {
 	return FString("ALSXT Slide Effects");
@@ -37,19 +102,22 @@ void UALSXTAnimNotify_SlideEffects::Notify(USkeletalMeshComponent* Mesh, UAnimSe
 		return;
 	}
 
-	const auto* Character{ Cast<AAlsCharacter>(Mesh->GetOwner()) };
-	AALSXTCharacter* ALSXTCharacter{ Cast<AALSXTCharacter>(Mesh->GetOwner()) };
+	const auto* ALSXTCharacter{ Cast<AALSXTCharacter>(Mesh->GetOwner()) };
 
 	if (IsValid(ALSXTCharacter) && ALSXTCharacter->GetLocomotionMode() == AlsLocomotionModeTags::InAir)
 	{
 		return;
 	}
 
-	const auto CapsuleScale{ IsValid(ALSXTCharacter) ? ALSXTCharacter->GetCapsuleComponent()->GetComponentScale().Z : 1.0f };
+	// Distant and off-screen characters, as well as dedicated servers, skip the surface probe altogether.
+	const auto Significance{UALSXTEffectsSignificanceSubsystem::GetSignificance(Mesh)};
 
-	const auto* World{ Mesh->GetWorld() };
-	const auto* AnimationInstance{ Mesh->GetAnimInstance() };
-	const auto* ALSXTAnimationInstance{ Cast<UALSXTAnimationInstance>(Mesh->GetAnimInstance()) };
+	if (Significance == EALSXTEffectsSignificance::None)
+	{
+		return;
+	}
+
+	const auto CapsuleScale{ IsValid(ALSXTCharacter) ? ALSXTCharacter->GetCapsuleComponent()->GetComponentScale().Z : 1.0f };
 
 	const auto FootBoneName{FootBone == EALSXTFootBone::Left ? UAlsConstants::FootLeftBoneName() : UAlsConstants::FootRightBoneName()};
 	const auto FootTransform{Mesh->GetSocketTransform(FootBoneName)};
@@ -60,33 +128,75 @@ void UALSXTAnimNotify_SlideEffects::Notify(USkeletalMeshComponent* Mesh, UAnimSe
 												 : SlideEffectsSettings->FootRightZAxis)
 	};
 
-	FHitResult Hit;
-	FVector HitLocation;
-	FVector HitNormal;
-	TWeakObjectPtr<UPrimitiveComponent> HitComponent;
-	TWeakObjectPtr<UPhysicalMaterial> HitPhysicalMaterial;
-	TEnumAsByte<EPhysicalSurface> HitSurface;
+	FALSXTFootSurfaceProbeRequest ProbeRequest;
+	ProbeRequest.Mesh = Mesh;
+	ProbeRequest.Foot = FootBone;
+	ProbeRequest.Start = FootTransform.GetLocation();
+	ProbeRequest.End = ProbeRequest.Start - FootZAxis * (SlideEffectsSettings->SurfaceTraceDistance * CapsuleScale);
+	ProbeRequest.TraceChannel = UEngineTypes::ConvertToCollisionChannel(SlideEffectsSettings->SurfaceTraceChannel);
+	ProbeRequest.ReuseDistance = SlideEffectsSettings->SurfaceTraceReuseDistance * CapsuleScale;
+
+	// This notify is shared by every mesh that plays the animation, so the foot transform is captured for the callback.
+	auto SpawnEffectsDelegate{
+		FALSXTFootSurfaceProbeDelegate::CreateWeakLambda(this, [this, WeakMesh = TWeakObjectPtr<USkeletalMeshComponent>{Mesh}, FootTransform, Significance](const FHitResult& Hit)
+		{
+			if (WeakMesh.IsValid())
+			{
+				ScheduleEffects(WeakMesh.Get(), FootTransform, Hit, Significance);
+			}
+		})
+	};
+
+	UALSXTFootSurfaceProbeSubsystem::ProbeSurface(Mesh->GetWorld(), ProbeRequest, MoveTemp(SpawnEffectsDelegate));
+}
+
+void UALSXTAnimNotify_SlideEffects::ScheduleEffects(USkeletalMeshComponent* Mesh, const FTransform& FootTransform, const FHitResult& Hit,
+	EALSXTEffectsSignificance Significance)
+{
+	FALSXTScheduledEffectRequest EffectRequest;
+	EffectRequest.Mesh = Mesh;
+	EffectRequest.Source = GetClass();
+	EffectRequest.Foot = FootBone;
+	EffectRequest.Location = FootTransform.GetLocation();
+
+	auto SpawnEffectsDelegate{
+		FALSXTScheduledEffectDelegate::CreateWeakLambda(this, [this, WeakMesh = TWeakObjectPtr<USkeletalMeshComponent>{Mesh}, FootTransform, Hit, Significance]
+		{
+			if (WeakMesh.IsValid())
+			{
+				SpawnEffects(WeakMesh.Get(), FootTransform, Hit, Significance);
+			}
+		})
+	};
+
+	UALSXTEffectsSchedulerSubsystem::ScheduleEffect(Mesh->GetWorld(), EffectRequest, MoveTemp(SpawnEffectsDelegate));
+}
+
+void UALSXTAnimNotify_SlideEffects::SpawnEffects(USkeletalMeshComponent* Mesh, const FTransform& FootTransform, const FHitResult& Hit,
+	EALSXTEffectsSignificance Significance)
+{
+	if (!IsValid(SlideEffectsSettings))
+	{
+		return;
+	}
+
+	const auto* ALSXTCharacter{ Cast<AALSXTCharacter>(Mesh->GetOwner()) };
+
+	const auto CapsuleScale{ IsValid(ALSXTCharacter) ? ALSXTCharacter->GetCapsuleComponent()->GetComponentScale().Z : 1.0f };
+
+	auto* World{ Mesh->GetWorld() };
+	const auto* AnimationInstance{ Mesh->GetAnimInstance() };
+
+	const auto FootBoneName{FootBone == EALSXTFootBone::Left ? UAlsConstants::FootLeftBoneName() : UAlsConstants::FootRightBoneName()};
 
 #if ENABLE_DRAW_DEBUG
 	const auto bDisplayDebug{ UAlsUtility::ShouldDisplayDebugForActor(Mesh->GetOwner(), UAlsConstants::TracesDisplayName()) };
 #endif
 
-	FCollisionQueryParams QueryParameters{ ANSI_TO_TCHAR(__FUNCTION__), true, Mesh->GetOwner() };
-	QueryParameters.bReturnPhysicalMaterial = true;
+	HitResult = Hit;
 
-	if (World->LineTraceSingleByChannel(Hit, FootTransform.GetLocation(),
-		FootTransform.GetLocation() - FootZAxis *
-		(SlideEffectsSettings->SurfaceTraceDistance * CapsuleScale),
-		UEngineTypes::ConvertToCollisionChannel(SlideEffectsSettings->SurfaceTraceChannel),
-		QueryParameters))
+	if (Hit.bBlockingHit)
 	{
-		HitResult = Hit;
-		HitLocation = HitResult.ImpactPoint;
-		HitNormal = HitResult.ImpactNormal;
-		HitComponent = HitResult.Component;
-		HitPhysicalMaterial = HitResult.PhysMaterial;
-		HitSurface = UGameplayStatics::GetSurfaceType(Hit);
-
 #if ENABLE_DRAW_DEBUG
 		if (bDisplayDebug)
 		{
@@ -98,33 +208,23 @@ void UALSXTAnimNotify_SlideEffects::Notify(USkeletalMeshComponent* Mesh, UAnimSe
 	else
 	{
 		HitResult.ImpactPoint = FootTransform.GetLocation();
-		Hit.ImpactPoint = FootTransform.GetLocation();
 		HitResult.ImpactNormal = FVector::UpVector;
-		Hit.ImpactNormal = FVector::UpVector;
-		HitLocation = FootTransform.GetLocation();
-		HitNormal = FVector::UpVector;
-		HitComponent = nullptr;
 		HitResult.Component = nullptr;
-		HitPhysicalMaterial = nullptr;
 		HitResult.PhysMaterial = nullptr;
-		HitSurface = SurfaceType_Default;
 	}
 
-	const auto SurfaceType{ HitSurface };
-	const auto* EffectSettings{ SlideEffectsSettings->Effects.Find(SurfaceType) };
-
-	if (EffectSettings == nullptr)
+	const auto SurfaceType{ Hit.bBlockingHit ? UGameplayStatics::GetSurfaceType(Hit) : SurfaceType_Default };
+	// Characters request the preload on begin play, this only covers meshes that are not driven by one.
+	if (!SlideEffectsSettings->IsPreloadRequested() && !IsRunningDedicatedServer())
 	{
-		for (const auto& Pair : SlideEffectsSettings->Effects)
-		{
-			EffectSettings = &Pair.Value;
-			break;
-		}
+		SlideEffectsSettings->RequestPreload();
+	}
 
-		if (EffectSettings == nullptr)
-		{
-			return;
-		}
+	const auto* EffectSettings{ SlideEffectsSettings->FindEffectSettings(SurfaceType) };
+
+	if (EffectSettings == nullptr || !UALSXTEffectsSignificanceSubsystem::ConsumeEffectBudget(World))
+	{
+		return;
 	}
 
 	const auto FootstepLocation{ HitResult.ImpactPoint };
@@ -144,7 +244,7 @@ void UALSXTAnimNotify_SlideEffects::Notify(USkeletalMeshComponent* Mesh, UAnimSe
 	}
 #endif
 
-	if (bSpawnSound)
+	if (bSpawnSound && UALSXTEffectsSignificanceSubsystem::IsSoundAllowed(Significance))
 	{
 		auto VolumeMultiplier{ SoundVolumeMultiplier };
 
@@ -153,9 +253,10 @@ void UALSXTAnimNotify_SlideEffects::Notify(USkeletalMeshComponent* Mesh, UAnimSe
 			VolumeMultiplier *= 1.0f - UAlsMath::Clamp01(AnimationInstance->GetCurveValue(UAlsConstants::FootstepSoundBlockCurveName()));
 		}
 
-		if (FAnimWeight::IsRelevant(VolumeMultiplier) && IsValid(EffectSettings->Sound.LoadSynchronous()))
+		if (FAnimWeight::IsRelevant(VolumeMultiplier) && IsValid(FALSXTEffectsPreloader::GetLoadedAsset(EffectSettings->Sound, World)))
 		{
 			UAudioComponent* Audio{ nullptr };
+			auto* AudioPool{World->GetSubsystem<UALSXTAudioEmitterSubsystem>()};
 
 			switch (EffectSettings->SoundSpawnType)
 			{
@@ -165,6 +266,12 @@ void UALSXTAnimNotify_SlideEffects::Notify(USkeletalMeshComponent* Mesh, UAnimSe
 					UGameplayStatics::PlaySoundAtLocation(World, EffectSettings->Sound.Get(), FootstepLocation,
 						VolumeMultiplier, SoundPitchMultiplier);
 				}
+				else if (IsValid(AudioPool))
+				{
+					Audio = AudioPool->PlaySoundAtLocation(EALSXTAudioEmitterCategory::Footstep, EffectSettings->Sound.Get(),
+						FootstepLocation, FootstepRotation.Rotator(),
+						VolumeMultiplier, SoundPitchMultiplier);
+				}
 				else
 				{
 					Audio = UGameplayStatics::SpawnSoundAtLocation(World, EffectSettings->Sound.Get(), FootstepLocation,
@@ -174,15 +281,24 @@ void UALSXTAnimNotify_SlideEffects::Notify(USkeletalMeshComponent* Mesh, UAnimSe
 				break;
 
 			case EALSXTFootstepSoundSpawnType::SpawnAttachedToFootBone:
-				Audio = UGameplayStatics::SpawnSoundAttached(EffectSettings->Sound.Get(), Mesh, FootBoneName, FVector::ZeroVector,
-					FRotator::ZeroRotator, EAttachLocation::SnapToTarget,
-					true, VolumeMultiplier, SoundPitchMultiplier);
+				if (IsValid(AudioPool))
+				{
+					Audio = AudioPool->PlaySoundAttached(EALSXTAudioEmitterCategory::Footstep, EffectSettings->Sound.Get(),
+						Mesh, FootBoneName, VolumeMultiplier, SoundPitchMultiplier);
+				}
+				else
+				{
+					Audio = UGameplayStatics::SpawnSoundAttached(EffectSettings->Sound.Get(), Mesh, FootBoneName, FVector::ZeroVector,
+						FRotator::ZeroRotator, EAttachLocation::SnapToTarget,
+						true, VolumeMultiplier, SoundPitchMultiplier);
+				}
 				break;
 			}
 		}
 	}
 
-	if (bSpawnParticleSystem && IsValid(EffectSettings->ParticleSystem.LoadSynchronous()))
+	if (bSpawnParticleSystem && UALSXTEffectsSignificanceSubsystem::IsParticleSystemAllowed(Significance) &&
+	    IsValid(FALSXTEffectsPreloader::GetLoadedAsset(EffectSettings->ParticleSystem, World)))
 	{
 		switch (EffectSettings->ParticleSystemSpawnType)
 		{
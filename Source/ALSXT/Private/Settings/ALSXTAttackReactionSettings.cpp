@@ -0,0 +1,34 @@
+// MIT
+
+#include "Settings/ALSXTAttackReactionSettings.h"
+
+void UALSXTAttackReactionSettings::PostLoad()
+{
+	Super::PostLoad();
+
+	CompileReactions();
+}
+
+#if WITH_EDITOR
+void UALSXTAttackReactionSettings::PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent)
+{
+	Super::PostEditChangeProperty(PropertyChangedEvent);
+
+	CompileReactions();
+}
+#endif
+
+void UALSXTAttackReactionSettings::CompileReactions() const
+{
+	ReactionTable.Compile(ImpactReactionLocations);
+}
+
+const FALSXTReactionMontageTable& UALSXTAttackReactionSettings::GetReactionTable() const
+{
+	if (!ReactionTable.IsCompiled())
+	{
+		CompileReactions();
+	}
+
+	return ReactionTable;
+}
@@ -0,0 +1,88 @@
+// MIT
+
+#include "Settings/ALSXTCharacterSoundSettings.h"
+
+void UALSXTCharacterSoundSettings::PostLoad()
+{
+	Super::PostLoad();
+
+	CompileSounds();
+}
+
+#if WITH_EDITOR
+void UALSXTCharacterSoundSettings::PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent)
+{
+	Super::PostEditChangeProperty(PropertyChangedEvent);
+
+	CompileSounds();
+}
+#endif
+
+void UALSXTCharacterSoundSettings::CompileSounds() const
+{
+	ActionSoundTable.Compile(ActionSounds, &FALSXTCharacterActionSound::Strength, &FALSXTCharacterActionSound::Stamina);
+	AttackSoundTable.Compile(AttackSounds, &FALSXTCharacterActionSound::Strength, &FALSXTCharacterActionSound::Stamina);
+	DamageSoundTable.Compile(DamageSounds, &FALSXTCharacterDamageSound::Form, &FALSXTCharacterDamageSound::Damage);
+	DeathSoundTable.Compile(DeathSounds, &FALSXTCharacterDamageSound::Form, &FALSXTCharacterDamageSound::Damage);
+}
+
+const FALSXTSoundTagTable& UALSXTCharacterSoundSettings::GetActionSoundTable() const
+{
+	if (!ActionSoundTable.IsCompiled())
+	{
+		CompileSounds();
+	}
+
+	return ActionSoundTable;
+}
+
+const FALSXTSoundTagTable& UALSXTCharacterSoundSettings::GetAttackSoundTable() const
+{
+	if (!AttackSoundTable.IsCompiled())
+	{
+		CompileSounds();
+	}
+
+	return AttackSoundTable;
+}
+
+const FALSXTSoundTagTable& UALSXTCharacterSoundSettings::GetDamageSoundTable() const
+{
+	if (!DamageSoundTable.IsCompiled())
+	{
+		CompileSounds();
+	}
+
+	return DamageSoundTable;
+}
+
+const FALSXTSoundTagTable& UALSXTCharacterSoundSettings::GetDeathSoundTable() const
+{
+	if (!DeathSoundTable.IsCompiled())
+	{
+		CompileSounds();
+	}
+
+	return DeathSoundTable;
+}
+
+const FALSXTCharacterSound* UALSXTCharacterSoundSettings::FindSound(const EALSXTCharacterSoundType Type, const int32 SoundIndex) const
+{
+	switch (Type)
+	{
+		case EALSXTCharacterSoundType::Action:
+			return ActionSounds.IsValidIndex(SoundIndex) ? &ActionSounds[SoundIndex].CharacterSound : nullptr;
+
+		case EALSXTCharacterSoundType::Attack:
+			return AttackSounds.IsValidIndex(SoundIndex) ? &AttackSounds[SoundIndex].CharacterSound : nullptr;
+
+		case EALSXTCharacterSoundType::Damage:
+			return DamageSounds.IsValidIndex(SoundIndex) ? &DamageSounds[SoundIndex].CharacterSound : nullptr;
+
+		case EALSXTCharacterSoundType::Death:
+			return DeathSounds.IsValidIndex(SoundIndex) ? &DeathSounds[SoundIndex].CharacterSound : nullptr;
+
+		default:
+			return nullptr;
+	}
+}
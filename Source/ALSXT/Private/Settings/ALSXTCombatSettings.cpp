@@ -0,0 +1,92 @@
+// MIT
+
+#include "Settings/ALSXTCombatSettings.h"
+
+void UALSXTCombatSettings::PostLoad()
+{
+	Super::PostLoad();
+
+	CompileAttackMontages();
+}
+
+#if WITH_EDITOR
+void UALSXTCombatSettings::PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent)
+{
+	Super::PostEditChangeProperty(PropertyChangedEvent);
+
+	CompileAttackMontages();
+}
+#endif
+
+void UALSXTCombatSettings::CompileAttackMontages() const
+{
+	AttackMontages.Reset();
+	AttackMontageSpans.Reset();
+
+	for (const auto& AttackType : AttackTypes)
+	{
+		for (const auto& AttackStrength : AttackType.AttackStrengths)
+		{
+			for (const auto& AttackStance : AttackStrength.AttackStances)
+			{
+				const FALSXTAttackMontageKey Key{AttackType.AttackType, AttackStrength.AttackStrength, AttackStance.AttackStance};
+
+				// The first matching entry wins, as it did when the arrays were searched linearly.
+				if (AttackStance.MontageInfo.IsEmpty() || AttackMontageSpans.Contains(Key))
+				{
+					continue;
+				}
+
+				AttackMontageSpans.Add(Key, {AttackMontages.Num(), AttackStance.MontageInfo.Num()});
+
+				for (const auto& MontageInfo : AttackStance.MontageInfo)
+				{
+					AttackMontages.Add(MontageInfo);
+				}
+			}
+		}
+	}
+
+	AttackMontages.Shrink();
+	AttackMontageSpans.Shrink();
+
+	bAttackMontagesCompiled = true;
+}
+
+int32 UALSXTCombatSettings::SelectAttackMontageIndex(const FGameplayTag& AttackType, const FGameplayTag& Strength,
+                                                     const FGameplayTag& Stance, const int32 PreviousMontageIndex) const
+{
+	if (!bAttackMontagesCompiled)
+	{
+		CompileAttackMontages();
+	}
+
+	const auto* Span{AttackMontageSpans.Find({AttackType, Strength, Stance})};
+
+	if (Span == nullptr)
+	{
+		return INDEX_NONE;
+	}
+
+	if (Span->Num <= 1)
+	{
+		return Span->FirstIndex;
+	}
+
+	const auto PreviousIndex{PreviousMontageIndex - Span->FirstIndex};
+
+	if (PreviousIndex < 0 || PreviousIndex >= Span->Num)
+	{
+		return Span->FirstIndex + FMath::RandHelper(Span->Num);
+	}
+
+	// Pick among the other montages by skipping over the previous one.
+	auto Index{FMath::RandHelper(Span->Num - 1)};
+
+	if (Index >= PreviousIndex)
+	{
+		Index += 1;
+	}
+
+	return Span->FirstIndex + Index;
+}
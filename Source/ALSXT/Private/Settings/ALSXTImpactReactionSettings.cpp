@@ -0,0 +1,34 @@
+// MIT
+
+#include "Settings/ALSXTImpactReactionSettings.h"
+
+void UALSXTImpactReactionSettings::PostLoad()
+{
+	Super::PostLoad();
+
+	CompileReactions();
+}
+
+#if WITH_EDITOR
+void UALSXTImpactReactionSettings::PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent)
+{
+	Super::PostEditChangeProperty(PropertyChangedEvent);
+
+	CompileReactions();
+}
+#endif
+
+void UALSXTImpactReactionSettings::CompileReactions() const
+{
+	ReactionTable.Compile(ImpactReactionLocations);
+}
+
+const FALSXTReactionMontageTable& UALSXTImpactReactionSettings::GetReactionTable() const
+{
+	if (!ReactionTable.IsCompiled())
+	{
+		CompileReactions();
+	}
+
+	return ReactionTable;
+}
@@ -0,0 +1,320 @@
+// MIT
+
+#include "Subsystems/ALSXTAudioEmitterSubsystem.h"
+
+#include "Components/AudioComponent.h"
+#include "Engine/World.h"
+#include "GameFramework/WorldSettings.h"
+#include "Sound/SoundBase.h"
+#include "Sound/SoundConcurrency.h"
+
+void UALSXTAudioEmitterSubsystem::OnWorldBeginPlay(UWorld& InWorld)
+{
+	Super::OnWorldBeginPlay(InWorld);
+
+	LoadCategoryConcurrencies();
+
+	// Dedicated servers and worlds without audio never play these sounds.
+	if (InWorld.GetAudioDeviceRaw() == nullptr)
+	{
+		return;
+	}
+
+	const auto Capacity{FootstepSettings.VoiceBudget + VocalSettings.VoiceBudget + ImpactSettings.VoiceBudget};
+
+	Emitters.Reserve(Capacity);
+	Slots.Reserve(Capacity);
+
+	while (Emitters.Num() < Capacity)
+	{
+		Emitters.Add(CreateEmitter());
+		Slots.AddDefaulted();
+	}
+}
+
+void UALSXTAudioEmitterSubsystem::Deinitialize()
+{
+	for (auto& Emitter : Emitters)
+	{
+		if (IsValid(Emitter))
+		{
+			Emitter->DestroyComponent();
+		}
+	}
+
+	Emitters.Reset();
+	Slots.Reset();
+
+	Super::Deinitialize();
+}
+
+bool UALSXTAudioEmitterSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	// Animation editors preview footsteps too.
+	return Super::DoesSupportWorldType(WorldType) || WorldType == EWorldType::EditorPreview;
+}
+
+void UALSXTAudioEmitterSubsystem::SetCategorySettings(const EALSXTAudioEmitterCategory Category,
+                                                      const FALSXTAudioEmitterCategorySettings& NewSettings)
+{
+	auto& Settings{GetMutableCategorySettings(Category)};
+
+	Settings = NewSettings;
+	Settings.VoiceBudget = FMath::Max(1, Settings.VoiceBudget);
+
+	LoadCategoryConcurrencies();
+}
+
+const FALSXTAudioEmitterCategorySettings& UALSXTAudioEmitterSubsystem::GetCategorySettings(const EALSXTAudioEmitterCategory Category) const
+{
+	switch (Category)
+	{
+		case EALSXTAudioEmitterCategory::Vocal:
+			return VocalSettings;
+
+		case EALSXTAudioEmitterCategory::Impact:
+			return ImpactSettings;
+
+		default:
+			return FootstepSettings;
+	}
+}
+
+FALSXTAudioEmitterCategorySettings& UALSXTAudioEmitterSubsystem::GetMutableCategorySettings(const EALSXTAudioEmitterCategory Category)
+{
+	return const_cast<FALSXTAudioEmitterCategorySettings&>(GetCategorySettings(Category));
+}
+
+FALSXTAudioEmitterPoolStats UALSXTAudioEmitterSubsystem::GetStats() const
+{
+	auto CurrentStats{Stats};
+	CurrentStats.ActiveVoices = 0;
+
+	for (const auto& Emitter : Emitters)
+	{
+		if (IsValid(Emitter) && Emitter->IsPlaying())
+		{
+			CurrentStats.ActiveVoices += 1;
+		}
+	}
+
+	return CurrentStats;
+}
+
+UAudioComponent* UALSXTAudioEmitterSubsystem::PlaySoundAtLocation(const EALSXTAudioEmitterCategory Category, USoundBase* Sound,
+                                                                  const FVector& Location, const FRotator& Rotation,
+                                                                  const float VolumeMultiplier, const float PitchMultiplier)
+{
+	auto* Emitter{AcquireEmitter(Category, Sound, VolumeMultiplier, PitchMultiplier, nullptr)};
+
+	if (!IsValid(Emitter))
+	{
+		return nullptr;
+	}
+
+	Emitter->SetWorldLocationAndRotation(Location, Rotation);
+	Emitter->Play();
+
+	return Emitter;
+}
+
+UAudioComponent* UALSXTAudioEmitterSubsystem::PlaySoundAttached(const EALSXTAudioEmitterCategory Category, USoundBase* Sound,
+                                                                USceneComponent* AttachComponent, const FName SocketName,
+                                                                const float VolumeMultiplier, const float PitchMultiplier)
+{
+	if (!IsValid(AttachComponent))
+	{
+		return nullptr;
+	}
+
+	auto* Emitter{AcquireEmitter(Category, Sound, VolumeMultiplier, PitchMultiplier, AttachComponent)};
+
+	if (!IsValid(Emitter))
+	{
+		return nullptr;
+	}
+
+	if (Emitter->GetAttachParent() != AttachComponent || Emitter->GetAttachSocketName() != SocketName)
+	{
+		Emitter->AttachToComponent(AttachComponent, FAttachmentTransformRules::SnapToTargetNotIncludingScale, SocketName);
+	}
+
+	Emitter->Play();
+
+	return Emitter;
+}
+
+void UALSXTAudioEmitterSubsystem::StopAllSounds()
+{
+	for (auto& Emitter : Emitters)
+	{
+		if (IsValid(Emitter))
+		{
+			Emitter->Stop();
+			Emitter->DetachFromComponent(FDetachmentTransformRules::KeepWorldTransform);
+		}
+	}
+}
+
+void UALSXTAudioEmitterSubsystem::LoadCategoryConcurrencies()
+{
+	CategoryConcurrencies.Reset();
+
+	for (const auto Category : {EALSXTAudioEmitterCategory::Footstep, EALSXTAudioEmitterCategory::Vocal, EALSXTAudioEmitterCategory::Impact})
+	{
+		CategoryConcurrencies.Add(GetCategorySettings(Category).Concurrency.LoadSynchronous());
+	}
+}
+
+UAudioComponent* UALSXTAudioEmitterSubsystem::AcquireEmitter(const EALSXTAudioEmitterCategory Category, USoundBase* Sound,
+                                                             const float VolumeMultiplier, const float PitchMultiplier,
+                                                             USceneComponent* AttachComponent)
+{
+	auto* World{GetWorld()};
+
+	if (!IsValid(World) || !IsValid(Sound) || World->GetAudioDeviceRaw() == nullptr)
+	{
+		return nullptr;
+	}
+
+	const auto& Settings{GetCategorySettings(Category)};
+
+	auto FreeIndex{INDEX_NONE};
+	auto StealIndex{INDEX_NONE};
+	auto ActiveVoices{0};
+
+	for (auto i{0}; i < Emitters.Num(); i++)
+	{
+		const auto* Emitter{Emitters[i].Get()};
+
+		// Emitters get destroyed together with a component they were attached to, their slot is filled again on use.
+		if (!IsValid(Emitter) || !Emitter->IsRegistered() || !Emitter->IsPlaying())
+		{
+			if (FreeIndex == INDEX_NONE)
+			{
+				FreeIndex = i;
+			}
+
+			continue;
+		}
+
+		if (Slots[i].Category != Category)
+		{
+			continue;
+		}
+
+		ActiveVoices += 1;
+
+		if (StealIndex == INDEX_NONE ||
+		    (Settings.StealingPolicy == EALSXTAudioVoiceStealingPolicy::StealQuietest
+			     ? Slots[i].VolumeMultiplier < Slots[StealIndex].VolumeMultiplier
+			     : Slots[i].PlayTime < Slots[StealIndex].PlayTime))
+		{
+			StealIndex = i;
+		}
+	}
+
+	int32 EmitterIndex;
+
+	if (ActiveVoices >= Settings.VoiceBudget)
+	{
+		if (Settings.StealingPolicy == EALSXTAudioVoiceStealingPolicy::DiscardNewest || StealIndex == INDEX_NONE)
+		{
+			Stats.TotalDiscarded += 1;
+			return nullptr;
+		}
+
+		Emitters[StealIndex]->Stop();
+		Stats.TotalStolen += 1;
+
+		EmitterIndex = StealIndex;
+	}
+	else if (FreeIndex != INDEX_NONE)
+	{
+		EmitterIndex = FreeIndex;
+	}
+	else
+	{
+		EmitterIndex = Emitters.Add(nullptr);
+		Slots.AddDefaulted();
+	}
+
+	auto* Emitter{Emitters[EmitterIndex].Get()};
+
+	if (!IsValid(Emitter) || !Emitter->IsRegistered())
+	{
+		Emitter = CreateEmitter();
+		Emitters[EmitterIndex] = Emitter;
+
+		if (!IsValid(Emitter))
+		{
+			return nullptr;
+		}
+	}
+
+	if (Emitter->GetAttachParent() != nullptr && Emitter->GetAttachParent() != AttachComponent)
+	{
+		Emitter->DetachFromComponent(FDetachmentTransformRules::KeepWorldTransform);
+	}
+
+	// Parameters set by the previous user of the emitter must not leak into the new sound.
+	Emitter->ResetParameters();
+	Emitter->SetSound(Sound);
+	Emitter->SetVolumeMultiplier(VolumeMultiplier);
+	Emitter->SetPitchMultiplier(PitchMultiplier);
+
+	Emitter->ConcurrencySet.Reset();
+
+	auto* Concurrency{CategoryConcurrencies.IsValidIndex(static_cast<int32>(Category))
+		                  ? CategoryConcurrencies[static_cast<int32>(Category)].Get()
+		                  : nullptr};
+
+	if (IsValid(Concurrency))
+	{
+		Emitter->ConcurrencySet.Add(Concurrency);
+	}
+
+	auto& Slot{Slots[EmitterIndex]};
+	Slot.Category = Category;
+	Slot.PlayTime = World->GetTimeSeconds();
+	Slot.VolumeMultiplier = VolumeMultiplier;
+
+	Stats.TotalPlayed += 1;
+
+	return Emitter;
+}
+
+UAudioComponent* UALSXTAudioEmitterSubsystem::CreateEmitter()
+{
+	auto* World{GetWorld()};
+	auto* WorldSettings{IsValid(World) ? World->GetWorldSettings() : nullptr};
+
+	if (!IsValid(WorldSettings))
+	{
+		return nullptr;
+	}
+
+	// Same setup as UGameplayStatics::SpawnSoundAtLocation(), but the component is kept alive between sounds.
+	auto* Emitter{NewObject<UAudioComponent>(WorldSettings)};
+	Emitter->bAutoActivate = false;
+	Emitter->bAutoDestroy = false;
+	Emitter->bAllowAnyoneToDestroyMe = true;
+	Emitter->bStopWhenOwnerDestroyed = false;
+	Emitter->SetUsingAbsoluteScale(true);
+	Emitter->RegisterComponentWithWorld(World);
+	Emitter->OnAudioFinishedNative.AddUObject(this, &ThisClass::OnEmitterFinished);
+
+	Stats.ComponentsCreated += 1;
+
+	return Emitter;
+}
+
+void UALSXTAudioEmitterSubsystem::OnEmitterFinished(UAudioComponent* Emitter)
+{
+	// Idle emitters must not stay attached to a bone and follow it around, or get destroyed together with its component.
+	// An emitter that was stolen may already play the next sound by the time this is called.
+	if (IsValid(Emitter) && !Emitter->IsPlaying() && Emitter->GetAttachParent() != nullptr)
+	{
+		Emitter->DetachFromComponent(FDetachmentTransformRules::KeepWorldTransform);
+	}
+}
@@ -0,0 +1,168 @@
+// MIT
+
+#include "Subsystems/ALSXTEffectsSchedulerSubsystem.h"
+
+#include "Components/SceneComponent.h"
+#include "Engine/World.h"
+#include "Subsystems/ALSXTEffectsSignificanceSubsystem.h"
+
+void UALSXTEffectsSchedulerSubsystem::Deinitialize()
+{
+	QueuedEffects.Reset();
+	QueuedEffectIndices.Reset();
+
+	Super::Deinitialize();
+}
+
+void UALSXTEffectsSchedulerSubsystem::Tick(const float DeltaTime)
+{
+	Super::Tick(DeltaTime);
+
+	ProcessQueue();
+}
+
+TStatId UALSXTEffectsSchedulerSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UALSXTEffectsSchedulerSubsystem, STATGROUP_Tickables);
+}
+
+bool UALSXTEffectsSchedulerSubsystem::IsTickable() const
+{
+	return QueuedEffects.Num() > 0;
+}
+
+void UALSXTEffectsSchedulerSubsystem::SetFrameBudget(const float NewFrameBudget)
+{
+	FrameBudget = FMath::Max(0.0f, NewFrameBudget);
+}
+
+FALSXTEffectsSchedulerStats UALSXTEffectsSchedulerSubsystem::GetStats() const
+{
+	auto CurrentStats{Stats};
+	CurrentStats.QueuedEffects = QueuedEffects.Num();
+
+	return CurrentStats;
+}
+
+void UALSXTEffectsSchedulerSubsystem::EnqueueEffect(const FALSXTScheduledEffectRequest& Request, FALSXTScheduledEffectDelegate&& Callback)
+{
+	const FQueuedEffectKey Key{Request.Mesh.Get(), Request.Source, Request.Foot};
+
+	FQueuedEffect* QueuedEffect;
+	const auto* QueuedEffectIndex{QueuedEffectIndices.Find(Key)};
+
+	if (QueuedEffectIndex != nullptr)
+	{
+		QueuedEffect = &QueuedEffects[*QueuedEffectIndex];
+		Stats.TotalDeduplicated += 1;
+	}
+	else
+	{
+		QueuedEffectIndices.Add(Key, QueuedEffects.Num());
+		QueuedEffect = &QueuedEffects.AddDefaulted_GetRef();
+	}
+
+	auto* SignificanceSubsystem{GetWorld()->GetSubsystem<UALSXTEffectsSignificanceSubsystem>()};
+
+	if (!IsValid(SignificanceSubsystem) ||
+	    !SignificanceSubsystem->TryGetClosestViewerDistanceSquared(Request.Location, QueuedEffect->DistanceSquared))
+	{
+		QueuedEffect->DistanceSquared = 0.0;
+	}
+
+	QueuedEffect->Request = Request;
+	QueuedEffect->Callback = MoveTemp(Callback);
+	QueuedEffect->EnqueueTime = GetWorld()->GetRealTimeSeconds();
+
+	Stats.PeakQueuedEffects = FMath::Max(Stats.PeakQueuedEffects, QueuedEffects.Num());
+}
+
+void UALSXTEffectsSchedulerSubsystem::ScheduleEffect(UWorld* World, const FALSXTScheduledEffectRequest& Request,
+                                                     FALSXTScheduledEffectDelegate&& Callback)
+{
+	auto* Scheduler{IsValid(World) ? World->GetSubsystem<UALSXTEffectsSchedulerSubsystem>() : nullptr};
+
+	if (IsValid(Scheduler))
+	{
+		Scheduler->EnqueueEffect(Request, MoveTemp(Callback));
+	}
+	else
+	{
+		Callback.ExecuteIfBound();
+	}
+}
+
+void UALSXTEffectsSchedulerSubsystem::ProcessQueue()
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(UALSXTEffectsSchedulerSubsystem::ProcessQueue)
+
+	// Effects may queue new effects, so they go into a fresh queue while this one is processed.
+	auto Effects{MoveTemp(QueuedEffects)};
+	QueuedEffects.Reset();
+	QueuedEffectIndices.Reset();
+
+	Effects.Sort([](const FQueuedEffect& A, const FQueuedEffect& B)
+	{
+		return A.DistanceSquared < B.DistanceSquared;
+	});
+
+	const auto StartTime{FPlatformTime::Seconds()};
+	const auto EndTime{StartTime + FrameBudget * 0.001};
+	const auto MinEnqueueTime{GetWorld()->GetRealTimeSeconds() - MaxQueueTime};
+
+	auto ProcessedEffects{0};
+	auto EffectIndex{0};
+
+	for (; EffectIndex < Effects.Num(); EffectIndex++)
+	{
+		auto& Effect{Effects[EffectIndex]};
+
+		if (!Effect.Request.Mesh.IsValid())
+		{
+			continue;
+		}
+
+		if (Effect.EnqueueTime < MinEnqueueTime)
+		{
+			Stats.TotalExpired += 1;
+			continue;
+		}
+
+		if (ProcessedEffects > 0 && FPlatformTime::Seconds() >= EndTime)
+		{
+			break;
+		}
+
+		Effect.Callback.ExecuteIfBound();
+		ProcessedEffects += 1;
+	}
+
+	for (; EffectIndex < Effects.Num(); EffectIndex++)
+	{
+		auto& Effect{Effects[EffectIndex]};
+
+		if (!Effect.Request.Mesh.IsValid())
+		{
+			continue;
+		}
+
+		// A request queued by one of the processed effects is newer than the one that was left over.
+		const FQueuedEffectKey Key{Effect.Request.Mesh.Get(), Effect.Request.Source, Effect.Request.Foot};
+
+		if (QueuedEffectIndices.Contains(Key))
+		{
+			Stats.TotalDeduplicated += 1;
+			continue;
+		}
+
+		QueuedEffectIndices.Add(Key, QueuedEffects.Num());
+		QueuedEffects.Emplace(MoveTemp(Effect));
+	}
+
+	const auto ProcessingTime{static_cast<float>((FPlatformTime::Seconds() - StartTime) * 1000.0)};
+
+	Stats.LastFrameProcessedEffects = ProcessedEffects;
+	Stats.LastFrameProcessingTime = ProcessingTime;
+	Stats.PeakFrameProcessingTime = FMath::Max(Stats.PeakFrameProcessingTime, ProcessingTime);
+	Stats.TotalProcessed += ProcessedEffects;
+}
@@ -0,0 +1,164 @@
+// MIT
+
+#include "Subsystems/ALSXTEffectsSignificanceSubsystem.h"
+
+#include "Components/PrimitiveComponent.h"
+#include "Engine/World.h"
+#include "GameFramework/PlayerController.h"
+
+void UALSXTEffectsSignificanceSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+	Super::Initialize(Collection);
+
+	SortTiers();
+}
+
+void UALSXTEffectsSignificanceSubsystem::SetTiers(const TArray<FALSXTEffectsSignificanceTier>& NewTiers)
+{
+	Tiers = NewTiers;
+
+	SortTiers();
+}
+
+void UALSXTEffectsSignificanceSubsystem::SetMaxEffectsPerFrame(const int32 NewMaxEffectsPerFrame)
+{
+	MaxEffectsPerFrame = FMath::Max(0, NewMaxEffectsPerFrame);
+}
+
+EALSXTEffectsSignificance UALSXTEffectsSignificanceSubsystem::EvaluateSignificance(const UPrimitiveComponent* Component)
+{
+	if (!IsValid(Component))
+	{
+		return EALSXTEffectsSignificance::None;
+	}
+
+	double MinDistanceSquared;
+
+	// Without a local viewer there is nothing to measure against, e.g. while simulating in the editor.
+	if (!TryGetClosestViewerDistanceSquared(Component->GetComponentLocation(), MinDistanceSquared))
+	{
+		return EALSXTEffectsSignificance::Full;
+	}
+
+	auto Significance{EALSXTEffectsSignificance::None};
+
+	for (const auto& Tier : Tiers)
+	{
+		if (MinDistanceSquared <= FMath::Square(Tier.MaxDistance))
+		{
+			Significance = Tier.Significance;
+			break;
+		}
+	}
+
+	if (bDemoteNotRenderedCharacters && !Component->WasRecentlyRendered())
+	{
+		Significance = IsSoundAllowed(Significance) ? EALSXTEffectsSignificance::SoundOnly : EALSXTEffectsSignificance::None;
+	}
+
+	return Significance;
+}
+
+bool UALSXTEffectsSignificanceSubsystem::TryGetClosestViewerDistanceSquared(const FVector& Location, double& DistanceSquared)
+{
+	RefreshViewerLocations();
+
+	if (ViewerLocations.IsEmpty())
+	{
+		return false;
+	}
+
+	DistanceSquared = TNumericLimits<double>::Max();
+
+	for (const auto& ViewerLocation : ViewerLocations)
+	{
+		DistanceSquared = FMath::Min(DistanceSquared, FVector::DistSquared(ViewerLocation, Location));
+	}
+
+	return true;
+}
+
+bool UALSXTEffectsSignificanceSubsystem::ConsumeEffectBudget()
+{
+	if (BudgetFrame != GFrameCounter)
+	{
+		BudgetFrame = GFrameCounter;
+		EffectsSpawnedThisFrame = 0;
+	}
+
+	if (MaxEffectsPerFrame > 0 && EffectsSpawnedThisFrame >= MaxEffectsPerFrame)
+	{
+		return false;
+	}
+
+	EffectsSpawnedThisFrame += 1;
+	return true;
+}
+
+EALSXTEffectsSignificance UALSXTEffectsSignificanceSubsystem::GetSignificance(const UPrimitiveComponent* Component)
+{
+	if (!IsValid(Component))
+	{
+		return EALSXTEffectsSignificance::None;
+	}
+
+	const auto* World{Component->GetWorld()};
+
+	if (!IsValid(World) || World->GetNetMode() == NM_DedicatedServer)
+	{
+		return EALSXTEffectsSignificance::None;
+	}
+
+	auto* SignificanceSubsystem{World->GetSubsystem<UALSXTEffectsSignificanceSubsystem>()};
+
+	return IsValid(SignificanceSubsystem)
+		       ? SignificanceSubsystem->EvaluateSignificance(Component)
+		       : EALSXTEffectsSignificance::Full;
+}
+
+bool UALSXTEffectsSignificanceSubsystem::ConsumeEffectBudget(UWorld* World)
+{
+	auto* SignificanceSubsystem{IsValid(World) ? World->GetSubsystem<UALSXTEffectsSignificanceSubsystem>() : nullptr};
+
+	return !IsValid(SignificanceSubsystem) || SignificanceSubsystem->ConsumeEffectBudget();
+}
+
+void UALSXTEffectsSignificanceSubsystem::SortTiers()
+{
+	Tiers.Sort([](const FALSXTEffectsSignificanceTier& A, const FALSXTEffectsSignificanceTier& B)
+	{
+		return A.MaxDistance < B.MaxDistance;
+	});
+
+	for (auto i{1}; i < Tiers.Num(); i++)
+	{
+		Tiers[i].Significance = FMath::Max(Tiers[i].Significance, Tiers[i - 1].Significance);
+	}
+}
+
+void UALSXTEffectsSignificanceSubsystem::RefreshViewerLocations()
+{
+	if (ViewerLocationsFrame == GFrameCounter)
+	{
+		return;
+	}
+
+	ViewerLocationsFrame = GFrameCounter;
+	ViewerLocations.Reset();
+
+	for (auto Iterator{GetWorld()->GetPlayerControllerIterator()}; Iterator; ++Iterator)
+	{
+		const auto* PlayerController{Iterator->Get()};
+
+		if (!IsValid(PlayerController) || !PlayerController->IsLocalController())
+		{
+			continue;
+		}
+
+		FVector ViewLocation;
+		FRotator ViewRotation;
+		PlayerController->GetPlayerViewPoint(ViewLocation, ViewRotation);
+
+		ViewerLocations.Add(ViewLocation);
+	}
+}
@@ -0,0 +1,190 @@
+// MIT
+
+#include "Subsystems/ALSXTFootSurfaceProbeSubsystem.h"
+
+#include "Components/SceneComponent.h"
+#include "Engine/World.h"
+
+void UALSXTFootSurfaceProbeSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+	Super::Initialize(Collection);
+
+	ProbeCompletedDelegate.BindUObject(this, &ThisClass::OnProbeCompleted);
+}
+
+void UALSXTFootSurfaceProbeSubsystem::Deinitialize()
+{
+	// Results that are still in flight are dropped by the unbound delegate.
+	ProbeCompletedDelegate.Unbind();
+
+	CachedProbes.Reset();
+	PendingProbeIds.Reset();
+	PendingProbes.Reset();
+
+	Super::Deinitialize();
+}
+
+bool UALSXTFootSurfaceProbeSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	// Animation editors preview footsteps too.
+	return Super::DoesSupportWorldType(WorldType) || WorldType == EWorldType::EditorPreview;
+}
+
+void UALSXTFootSurfaceProbeSubsystem::ProbeSurface(UWorld* World, const FALSXTFootSurfaceProbeRequest& Request,
+                                                   FALSXTFootSurfaceProbeDelegate&& Callback)
+{
+	if (!IsValid(World))
+	{
+		return;
+	}
+
+	auto* ProbeSubsystem{World->GetSubsystem<UALSXTFootSurfaceProbeSubsystem>()};
+
+	if (IsValid(ProbeSubsystem))
+	{
+		ProbeSubsystem->RequestProbe(Request, MoveTemp(Callback));
+		return;
+	}
+
+	FHitResult Hit;
+
+	if (!World->LineTraceSingleByChannel(Hit, Request.Start, Request.End, Request.TraceChannel, MakeQueryParameters(Request)))
+	{
+		MakeMissHit(Request.Start, Request.End, Hit);
+	}
+
+	Callback.ExecuteIfBound(Hit);
+}
+
+void UALSXTFootSurfaceProbeSubsystem::RequestProbe(const FALSXTFootSurfaceProbeRequest& Request, FALSXTFootSurfaceProbeDelegate&& Callback)
+{
+	const FALSXTFootSurfaceProbeKey Key{Request.Mesh.Get(), Request.Foot};
+
+	if (Request.ReuseDistance > 0.0f)
+	{
+		const auto* CachedProbe{CachedProbes.Find(Key)};
+
+		if (CachedProbe != nullptr && CachedProbe->TraceChannel == Request.TraceChannel &&
+		    FVector::DistSquared(CachedProbe->Start, Request.Start) <= FMath::Square(Request.ReuseDistance) &&
+		    FVector::DistSquared(CachedProbe->End, Request.End) <= FMath::Square(Request.ReuseDistance) &&
+		    (!CachedProbe->Hit.bBlockingHit || CachedProbe->Hit.Component.IsValid()))
+		{
+			Callback.ExecuteIfBound(CachedProbe->Hit);
+			return;
+		}
+	}
+
+	// Both feet of a character usually ask at most once per frame, but a slide and a footstep notify can overlap.
+	const auto* PendingProbeId{PendingProbeIds.Find(Key)};
+
+	if (PendingProbeId != nullptr)
+	{
+		auto* PendingProbe{PendingProbes.Find(*PendingProbeId)};
+
+		if (PendingProbe != nullptr && PendingProbe->TraceChannel == Request.TraceChannel)
+		{
+			PendingProbe->Callbacks.Emplace(MoveTemp(Callback));
+			return;
+		}
+	}
+
+	const auto ProbeId{NextProbeId};
+	NextProbeId = NextProbeId == MAX_uint32 ? 1 : NextProbeId + 1;
+
+	auto& PendingProbe{PendingProbes.Add(ProbeId)};
+	PendingProbe.Key = Key;
+	PendingProbe.Start = Request.Start;
+	PendingProbe.End = Request.End;
+	PendingProbe.TraceChannel = Request.TraceChannel;
+	PendingProbe.Callbacks.Emplace(MoveTemp(Callback));
+
+	PendingProbeIds.Add(Key, ProbeId);
+
+	GetWorld()->AsyncLineTraceByChannel(EAsyncTraceType::Single, Request.Start, Request.End, Request.TraceChannel,
+	                                    MakeQueryParameters(Request), FCollisionResponseParams::DefaultResponseParam,
+	                                    &ProbeCompletedDelegate, ProbeId);
+}
+
+void UALSXTFootSurfaceProbeSubsystem::InvalidateProbes(const USceneComponent* Mesh)
+{
+	CachedProbes.Remove({Mesh, EALSXTFootBone::Left});
+	CachedProbes.Remove({Mesh, EALSXTFootBone::Right});
+}
+
+FCollisionQueryParams UALSXTFootSurfaceProbeSubsystem::MakeQueryParameters(const FALSXTFootSurfaceProbeRequest& Request)
+{
+	const auto* Mesh{Request.Mesh.Get()};
+
+	FCollisionQueryParams QueryParameters{ANSI_TO_TCHAR(__FUNCTION__), true, IsValid(Mesh) ? Mesh->GetOwner() : nullptr};
+	QueryParameters.bReturnPhysicalMaterial = true;
+
+	return QueryParameters;
+}
+
+void UALSXTFootSurfaceProbeSubsystem::MakeMissHit(const FVector& Start, const FVector& End, FHitResult& Hit)
+{
+	Hit = FHitResult{Start, End};
+	Hit.ImpactPoint = Start;
+	Hit.ImpactNormal = FVector::UpVector;
+}
+
+void UALSXTFootSurfaceProbeSubsystem::OnProbeCompleted(const FTraceHandle& TraceHandle, FTraceDatum& TraceDatum)
+{
+	FPendingProbe PendingProbe;
+
+	if (!PendingProbes.RemoveAndCopyValue(TraceDatum.UserData, PendingProbe))
+	{
+		return;
+	}
+
+	PendingProbeIds.Remove(PendingProbe.Key);
+
+	auto& CachedProbe{CachedProbes.FindOrAdd(PendingProbe.Key)};
+	CachedProbe.Start = PendingProbe.Start;
+	CachedProbe.End = PendingProbe.End;
+	CachedProbe.TraceChannel = PendingProbe.TraceChannel;
+
+	const auto* BlockingHit{
+		TraceDatum.OutHits.FindByPredicate([](const FHitResult& Hit)
+		{
+			return Hit.bBlockingHit;
+		})
+	};
+
+	if (BlockingHit != nullptr)
+	{
+		CachedProbe.Hit = *BlockingHit;
+	}
+	else
+	{
+		MakeMissHit(PendingProbe.Start, PendingProbe.End, CachedProbe.Hit);
+	}
+
+	// Callbacks may request new probes, so they must not reference the cache entry directly.
+	const auto Hit{CachedProbe.Hit};
+
+	for (auto& Callback : PendingProbe.Callbacks)
+	{
+		Callback.ExecuteIfBound(Hit);
+	}
+
+	CompletedProbesSinceCleanup += 1;
+
+	if (CompletedProbesSinceCleanup >= 256)
+	{
+		RemoveStaleProbes();
+	}
+}
+
+void UALSXTFootSurfaceProbeSubsystem::RemoveStaleProbes()
+{
+	CompletedProbesSinceCleanup = 0;
+
+	for (auto Iterator{CachedProbes.CreateIterator()}; Iterator; ++Iterator)
+	{
+		if (Iterator.Key().Mesh.ResolveObjectPtr() == nullptr)
+		{
+			Iterator.RemoveCurrent();
+		}
+	}
+}
@@ -0,0 +1,236 @@
+// MIT
+
+#include "Subsystems/ALSXTFootprintDecalSubsystem.h"
+
+#include "Components/DecalComponent.h"
+#include "Engine/World.h"
+#include "GameFramework/WorldSettings.h"
+#include "Materials/MaterialInterface.h"
+
+void UALSXTFootprintDecalSubsystem::OnWorldBeginPlay(UWorld& InWorld)
+{
+	Super::OnWorldBeginPlay(InWorld);
+
+	// Dedicated servers never render decals.
+	if (!InWorld.IsNetMode(NM_DedicatedServer))
+	{
+		FillPool();
+	}
+}
+
+void UALSXTFootprintDecalSubsystem::Deinitialize()
+{
+	DestroyDecals(0);
+
+	Super::Deinitialize();
+}
+
+bool UALSXTFootprintDecalSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	// Animation editors preview footsteps too.
+	return Super::DoesSupportWorldType(WorldType) || WorldType == EWorldType::EditorPreview;
+}
+
+void UALSXTFootprintDecalSubsystem::SetCapacity(const int32 NewCapacity)
+{
+	Capacity = FMath::Max(1, NewCapacity);
+
+	if (Decals.Num() > Capacity)
+	{
+		DestroyDecals(Capacity);
+	}
+
+	if (NextSlotIndex >= Capacity)
+	{
+		NextSlotIndex = 0;
+	}
+}
+
+void UALSXTFootprintDecalSubsystem::SetEvictionPolicy(const EALSXTFootprintDecalEvictionPolicy NewEvictionPolicy)
+{
+	EvictionPolicy = NewEvictionPolicy;
+}
+
+FALSXTFootprintDecalPoolStats UALSXTFootprintDecalSubsystem::GetStats() const
+{
+	auto CurrentStats{Stats};
+	CurrentStats.Capacity = Capacity;
+	CurrentStats.ActiveDecals = 0;
+
+	const auto* World{GetWorld()};
+	const auto WorldTime{IsValid(World) ? World->GetTimeSeconds() : 0.0};
+
+	for (auto i{0}; i < Decals.Num(); i++)
+	{
+		const auto* Decal{Decals[i].Get()};
+
+		if (!IsValid(Decal) || !Decal->IsVisible())
+		{
+			continue;
+		}
+
+		const auto Lifetime{Decal->GetFadeStartDelay() + Decal->GetFadeDuration()};
+
+		if (Lifetime <= 0.0f || SlotAcquireTimes[i] + Lifetime > WorldTime)
+		{
+			CurrentStats.ActiveDecals += 1;
+		}
+	}
+
+	return CurrentStats;
+}
+
+UDecalComponent* UALSXTFootprintDecalSubsystem::AcquireDecal(UMaterialInterface* Material, const FVector& Size,
+                                                             const FVector& Location, const FRotator& Rotation,
+                                                             USceneComponent* AttachComponent)
+{
+	auto* World{GetWorld()};
+
+	if (!IsValid(World) || World->IsNetMode(NM_DedicatedServer))
+	{
+		return nullptr;
+	}
+
+	if (NextSlotIndex >= Decals.Num())
+	{
+		Decals.SetNum(NextSlotIndex + 1);
+		SlotAcquireTimes.SetNumZeroed(NextSlotIndex + 1);
+	}
+
+	auto* Decal{Decals[NextSlotIndex].Get()};
+
+	if (!IsValid(Decal) || !Decal->IsRegistered())
+	{
+		// The slot was never filled, or its component got destroyed together with a component it was attached to.
+		Decal = CreateDecal();
+		Decals[NextSlotIndex] = Decal;
+	}
+	else if (Decal->IsVisible())
+	{
+		const auto Lifetime{Decal->GetFadeStartDelay() + Decal->GetFadeDuration()};
+		const auto bStillVisible{Lifetime <= 0.0f || SlotAcquireTimes[NextSlotIndex] + Lifetime > World->GetTimeSeconds()};
+
+		if (bStillVisible)
+		{
+			if (EvictionPolicy == EALSXTFootprintDecalEvictionPolicy::DiscardNewest)
+			{
+				Stats.TotalDiscarded += 1;
+				return nullptr;
+			}
+
+			Stats.TotalEvicted += 1;
+		}
+	}
+
+	if (!IsValid(Decal))
+	{
+		return nullptr;
+	}
+
+	if (Decal->GetAttachParent() != AttachComponent)
+	{
+		Decal->DetachFromComponent(FDetachmentTransformRules::KeepWorldTransform);
+	}
+
+	// Reset the previous footprint fading, this also clears the engine self-destruct timer.
+	Decal->SetFadeOut(0.0f, 0.0f, false);
+
+	Decal->SetDecalMaterial(Material);
+	Decal->DecalSize = Size;
+	Decal->SetWorldLocationAndRotation(Location, Rotation);
+
+	if (IsValid(AttachComponent) && Decal->GetAttachParent() != AttachComponent)
+	{
+		Decal->AttachToComponent(AttachComponent, FAttachmentTransformRules::KeepWorldTransform);
+	}
+
+	Decal->SetVisibility(true);
+	Decal->MarkRenderStateDirty();
+
+	SlotAcquireTimes[NextSlotIndex] = World->GetTimeSeconds();
+	NextSlotIndex = (NextSlotIndex + 1) % Capacity;
+
+	Stats.TotalAcquired += 1;
+
+	return Decal;
+}
+
+void UALSXTFootprintDecalSubsystem::SetDecalFadeOut(UDecalComponent* Decal, const float StartDelay, const float Duration)
+{
+	if (!IsValid(Decal))
+	{
+		return;
+	}
+
+	Decal->SetFadeOut(StartDelay, Duration, false);
+
+	// Pooled decals must outlive their fade, so cancel the timer that SetFadeOut() started.
+	Decal->SetLifeSpan(0.0f);
+
+	// Restarts the fade from the current world time, even if the fade values did not change since the last footprint.
+	Decal->MarkRenderStateDirty();
+}
+
+void UALSXTFootprintDecalSubsystem::HideAllDecals()
+{
+	for (auto& Decal : Decals)
+	{
+		if (IsValid(Decal))
+		{
+			Decal->DetachFromComponent(FDetachmentTransformRules::KeepWorldTransform);
+			Decal->SetVisibility(false);
+		}
+	}
+
+	NextSlotIndex = 0;
+}
+
+void UALSXTFootprintDecalSubsystem::FillPool()
+{
+	Decals.SetNum(Capacity);
+	SlotAcquireTimes.SetNumZeroed(Capacity);
+
+	for (auto& Decal : Decals)
+	{
+		if (!IsValid(Decal))
+		{
+			Decal = CreateDecal();
+		}
+	}
+}
+
+UDecalComponent* UALSXTFootprintDecalSubsystem::CreateDecal()
+{
+	auto* World{GetWorld()};
+	auto* WorldSettings{IsValid(World) ? World->GetWorldSettings() : nullptr};
+
+	if (!IsValid(WorldSettings))
+	{
+		return nullptr;
+	}
+
+	// Same setup as UGameplayStatics::SpawnDecalAtLocation(), but the component is kept alive and hidden between uses.
+	auto* Decal{NewObject<UDecalComponent>(WorldSettings)};
+	Decal->bAllowAnyoneToDestroyMe = true;
+	Decal->SetUsingAbsoluteScale(true);
+	Decal->SetVisibility(false);
+	Decal->RegisterComponentWithWorld(World);
+
+	Stats.ComponentsCreated += 1;
+
+	return Decal;
+}
+
+void UALSXTFootprintDecalSubsystem::DestroyDecals(const int32 FirstIndex)
+{
+	for (auto i{FirstIndex}; i < Decals.Num(); i++)
+	{
+		if (IsValid(Decals[i]))
+		{
+			Decals[i]->DestroyComponent();
+		}
+	}
+
+	Decals.SetNum(FMath::Min(FirstIndex, Decals.Num()));
+	SlotAcquireTimes.SetNum(Decals.Num());
+}
@@ -0,0 +1,323 @@
+// MIT
+
+#include "Subsystems/ALSXTImpactEffectPoolSubsystem.h"
+
+#include "Engine/World.h"
+#include "GameFramework/Actor.h"
+#include "Interfaces/ALSXTPooledEffectInterface.h"
+#include "Particles/ParticleSystemComponent.h"
+
+void UALSXTImpactEffectPoolSubsystem::OnWorldBeginPlay(UWorld& InWorld)
+{
+	Super::OnWorldBeginPlay(InWorld);
+
+	for (const auto& Settings : ClassSettings)
+	{
+		auto* ActorClass{Settings.ActorClass.LoadSynchronous()};
+
+		if (!IsValid(ActorClass))
+		{
+			continue;
+		}
+
+		auto& Pool{FindOrAddPool(ActorClass)};
+
+		while (Pool.Effects.Num() < FMath::Min(Settings.WarmUpCount, Pool.MaxSize) && SpawnEffect(ActorClass, Pool)) {}
+	}
+}
+
+void UALSXTImpactEffectPoolSubsystem::Deinitialize()
+{
+	// The pooled actors belong to the world and are destroyed with it.
+	Pools.Reset();
+	ActiveEffects = 0;
+
+	Super::Deinitialize();
+}
+
+void UALSXTImpactEffectPoolSubsystem::Tick(const float DeltaTime)
+{
+	Super::Tick(DeltaTime);
+
+	const auto WorldTime{GetWorld()->GetTimeSeconds()};
+
+	for (auto& Pool : Pools)
+	{
+		if (Pool.Value.ActiveEffects <= 0)
+		{
+			continue;
+		}
+
+		for (auto& Effect : Pool.Value.Effects)
+		{
+			if (!Effect.bActive)
+			{
+				continue;
+			}
+
+			auto bFinished{
+				!Effect.Actor.IsValid() ||
+				(Pool.Value.MaxLifetime > 0.0f && WorldTime >= Effect.AcquireTime + Pool.Value.MaxLifetime)
+			};
+
+			// Give the particle systems a frame to spawn, then wait for all of them to finish.
+			if (!bFinished && Effect.ParticleSystems.Num() > 0 && Effect.AcquireFrame != GFrameCounter)
+			{
+				bFinished = true;
+
+				for (const auto& ParticleSystem : Effect.ParticleSystems)
+				{
+					if (ParticleSystem.IsValid() && ParticleSystem->IsActive())
+					{
+						bFinished = false;
+						break;
+					}
+				}
+			}
+
+			if (bFinished)
+			{
+				DeactivateEffect(Effect, Pool.Value);
+			}
+		}
+	}
+}
+
+TStatId UALSXTImpactEffectPoolSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UALSXTImpactEffectPoolSubsystem, STATGROUP_Tickables);
+}
+
+bool UALSXTImpactEffectPoolSubsystem::IsTickable() const
+{
+	return ActiveEffects > 0;
+}
+
+FALSXTImpactEffectPoolStats UALSXTImpactEffectPoolSubsystem::GetStats() const
+{
+	auto CurrentStats{Stats};
+	CurrentStats.ActiveEffects = ActiveEffects;
+
+	return CurrentStats;
+}
+
+AActor* UALSXTImpactEffectPoolSubsystem::AcquireEffect(const TSubclassOf<AActor> ActorClass, const FTransform& Transform)
+{
+	if (!IsValid(ActorClass) || !IsValid(GetWorld()))
+	{
+		return nullptr;
+	}
+
+	auto& Pool{FindOrAddPool(ActorClass)};
+
+	auto EffectIndex{INDEX_NONE};
+	auto OldestIndex{INDEX_NONE};
+
+	// Backwards, because actors destroyed by someone else are removed on the way.
+	for (auto i{Pool.Effects.Num() - 1}; i >= 0; i--)
+	{
+		auto& Effect{Pool.Effects[i]};
+
+		if (!Effect.Actor.IsValid() || Effect.Actor->IsActorBeingDestroyed())
+		{
+			if (Effect.bActive)
+			{
+				Pool.ActiveEffects -= 1;
+				ActiveEffects -= 1;
+			}
+
+			Pool.Effects.RemoveAtSwap(i, 1, false);
+
+			if (EffectIndex == Pool.Effects.Num())
+			{
+				EffectIndex = i;
+			}
+
+			if (OldestIndex == Pool.Effects.Num())
+			{
+				OldestIndex = i;
+			}
+
+			continue;
+		}
+
+		if (!Effect.bActive)
+		{
+			EffectIndex = i;
+		}
+		else if (OldestIndex == INDEX_NONE || Effect.AcquireTime < Pool.Effects[OldestIndex].AcquireTime)
+		{
+			OldestIndex = i;
+		}
+	}
+
+	if (EffectIndex == INDEX_NONE)
+	{
+		if (Pool.Effects.Num() < Pool.MaxSize && SpawnEffect(ActorClass, Pool))
+		{
+			EffectIndex = Pool.Effects.Num() - 1;
+		}
+		else if (OldestIndex != INDEX_NONE)
+		{
+			DeactivateEffect(Pool.Effects[OldestIndex], Pool);
+			Stats.TotalRecycled += 1;
+
+			EffectIndex = OldestIndex;
+		}
+		else
+		{
+			return nullptr;
+		}
+	}
+
+	auto& Effect{Pool.Effects[EffectIndex]};
+	ActivateEffect(Effect, Pool, Transform);
+
+	Stats.TotalAcquired += 1;
+
+	return Effect.Actor.Get();
+}
+
+void UALSXTImpactEffectPoolSubsystem::ReleaseAllEffects()
+{
+	for (auto& Pool : Pools)
+	{
+		for (auto& Effect : Pool.Value.Effects)
+		{
+			if (Effect.bActive)
+			{
+				DeactivateEffect(Effect, Pool.Value);
+			}
+		}
+	}
+}
+
+UALSXTImpactEffectPoolSubsystem::FClassPool& UALSXTImpactEffectPoolSubsystem::FindOrAddPool(UClass* ActorClass)
+{
+	auto* Pool{Pools.Find(ActorClass)};
+
+	if (Pool != nullptr)
+	{
+		return *Pool;
+	}
+
+	const auto* Settings{
+		ClassSettings.FindByPredicate([ActorClass](const FALSXTImpactEffectClassSettings& ClassSetting)
+		{
+			return ClassSetting.ActorClass.Get() == ActorClass;
+		})
+	};
+
+	if (Settings == nullptr)
+	{
+		Settings = &DefaultClassSettings;
+	}
+
+	auto& NewPool{Pools.Add(ActorClass)};
+	NewPool.MaxSize = FMath::Max(1, Settings->MaxSize);
+	NewPool.MaxLifetime = Settings->MaxLifetime;
+
+	return NewPool;
+}
+
+bool UALSXTImpactEffectPoolSubsystem::SpawnEffect(UClass* ActorClass, FClassPool& Pool)
+{
+	FActorSpawnParameters SpawnParameters;
+	SpawnParameters.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+	SpawnParameters.ObjectFlags |= RF_Transient;
+
+	auto* Actor{GetWorld()->SpawnActor<AActor>(ActorClass, FTransform::Identity, SpawnParameters)};
+
+	if (!IsValid(Actor))
+	{
+		return false;
+	}
+
+	// Pooled actors must not destroy themselves, the pool lifetime replaces the actor life span.
+	Actor->SetLifeSpan(0.0f);
+
+	auto& Effect{Pool.Effects.AddDefaulted_GetRef()};
+	Effect.Actor = Actor;
+	Effect.bCollisionEnabled = Actor->GetActorEnableCollision();
+
+	TInlineComponentArray<UFXSystemComponent*> ParticleSystems{Actor};
+
+	for (auto* ParticleSystem : ParticleSystems)
+	{
+		Effect.ParticleSystems.Add(ParticleSystem);
+	}
+
+	// Park the new actor until it is used.
+	Effect.bActive = true;
+	Pool.ActiveEffects += 1;
+	ActiveEffects += 1;
+
+	DeactivateEffect(Effect, Pool);
+
+	Stats.ActorsSpawned += 1;
+
+	return true;
+}
+
+void UALSXTImpactEffectPoolSubsystem::ActivateEffect(FPooledEffect& Effect, FClassPool& Pool, const FTransform& Transform)
+{
+	auto* Actor{Effect.Actor.Get()};
+
+	Actor->SetActorTransform(Transform, false, nullptr, ETeleportType::ResetPhysics);
+	Actor->SetActorHiddenInGame(false);
+	Actor->SetActorEnableCollision(Effect.bCollisionEnabled);
+	Actor->SetActorTickEnabled(true);
+
+	for (const auto& ParticleSystem : Effect.ParticleSystems)
+	{
+		if (ParticleSystem.IsValid())
+		{
+			ParticleSystem->Activate(true);
+		}
+	}
+
+	Effect.AcquireTime = GetWorld()->GetTimeSeconds();
+	Effect.AcquireFrame = GFrameCounter;
+	Effect.bActive = true;
+
+	Pool.ActiveEffects += 1;
+	ActiveEffects += 1;
+
+	if (Actor->Implements<UALSXTPooledEffectInterface>())
+	{
+		IALSXTPooledEffectInterface::Execute_OnAcquiredFromPool(Actor);
+	}
+}
+
+void UALSXTImpactEffectPoolSubsystem::DeactivateEffect(FPooledEffect& Effect, FClassPool& Pool)
+{
+	auto* Actor{Effect.Actor.Get()};
+
+	if (IsValid(Actor))
+	{
+		for (const auto& ParticleSystem : Effect.ParticleSystems)
+		{
+			if (ParticleSystem.IsValid())
+			{
+				ParticleSystem->DeactivateImmediate();
+			}
+		}
+
+		Actor->SetActorHiddenInGame(true);
+		Actor->SetActorEnableCollision(false);
+		Actor->SetActorTickEnabled(false);
+
+		// A life span set while the effect was playing would destroy the parked actor later.
+		Actor->SetLifeSpan(0.0f);
+
+		if (Actor->Implements<UALSXTPooledEffectInterface>())
+		{
+			IALSXTPooledEffectInterface::Execute_OnReturnedToPool(Actor);
+		}
+	}
+
+	Effect.bActive = false;
+
+	Pool.ActiveEffects -= 1;
+	ActiveEffects -= 1;
+}
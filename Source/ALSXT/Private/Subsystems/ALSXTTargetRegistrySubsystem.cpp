@@ -0,0 +1,216 @@
+// MIT
+
+#include "Subsystems/ALSXTTargetRegistrySubsystem.h"
+
+#include "Engine/Level.h"
+#include "Engine/World.h"
+#include "GameFramework/Actor.h"
+#include "Interfaces/ALSXTTargetLockInterface.h"
+
+void UALSXTTargetRegistrySubsystem::OnWorldBeginPlay(UWorld& InWorld)
+{
+	Super::OnWorldBeginPlay(InWorld);
+
+	ActorSpawnedHandle = InWorld.AddOnActorSpawnedHandler(FOnActorSpawned::FDelegate::CreateUObject(this, &ThisClass::OnActorSpawned));
+	LevelAddedHandle = FWorldDelegates::LevelAddedToWorld.AddUObject(this, &ThisClass::OnLevelAdded);
+
+	for (const auto& Level : InWorld.GetLevels())
+	{
+		RegisterLevelTargets(Level);
+	}
+}
+
+void UALSXTTargetRegistrySubsystem::Deinitialize()
+{
+	if (ActorSpawnedHandle.IsValid())
+	{
+		GetWorld()->RemoveOnActorSpawnedHandler(ActorSpawnedHandle);
+		ActorSpawnedHandle.Reset();
+	}
+
+	FWorldDelegates::LevelAddedToWorld.Remove(LevelAddedHandle);
+	LevelAddedHandle.Reset();
+
+	Targets.Reset();
+	TargetIndices.Reset();
+	Cells.Reset();
+
+	Super::Deinitialize();
+}
+
+void UALSXTTargetRegistrySubsystem::RegisterTarget(AActor* Actor)
+{
+	if (!IsValid(Actor) || TargetIndices.Contains(Actor))
+	{
+		return;
+	}
+
+	const auto TargetIndex{Targets.Num()};
+
+	auto& Target{Targets.AddDefaulted_GetRef()};
+	Target.Actor = Actor;
+	Target.Key = Actor;
+	Target.Location = Actor->GetActorLocation();
+	Target.Cell = GetCell(Target.Location);
+
+	TargetIndices.Add(Actor, TargetIndex);
+	AddToCell(Target.Cell, TargetIndex);
+}
+
+void UALSXTTargetRegistrySubsystem::UnregisterTarget(AActor* Actor)
+{
+	const auto* TargetIndex{TargetIndices.Find(Actor)};
+
+	if (TargetIndex != nullptr)
+	{
+		RemoveTargetAt(*TargetIndex);
+	}
+}
+
+void UALSXTTargetRegistrySubsystem::QueryTargets(const FVector& Location, const float Radius,
+                                                 TArray<AActor*>& OutActors, TArray<FVector>& OutLocations)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(UALSXTTargetRegistrySubsystem::QueryTargets)
+
+	RefreshTargets();
+
+	const auto MinCell{GetCell(Location - FVector{Radius})};
+	const auto MaxCell{GetCell(Location + FVector{Radius})};
+	const auto RadiusSquared{FMath::Square(Radius)};
+
+	for (auto X{MinCell.X}; X <= MaxCell.X; X++)
+	{
+		for (auto Y{MinCell.Y}; Y <= MaxCell.Y; Y++)
+		{
+			const auto* Cell{Cells.Find({X, Y})};
+
+			if (Cell == nullptr)
+			{
+				continue;
+			}
+
+			for (const auto TargetIndex : *Cell)
+			{
+				const auto& Target{Targets[TargetIndex]};
+
+				if (FVector::DistSquared(Target.Location, Location) <= RadiusSquared)
+				{
+					OutActors.Add(Target.Actor.Get());
+					OutLocations.Add(Target.Location);
+				}
+			}
+		}
+	}
+}
+
+void UALSXTTargetRegistrySubsystem::OnActorSpawned(AActor* Actor)
+{
+	// The interface is only looked up once per actor, never during target queries.
+	if (IsValid(Actor) && Actor->Implements<UALSXTTargetLockInterface>())
+	{
+		RegisterTarget(Actor);
+	}
+}
+
+void UALSXTTargetRegistrySubsystem::OnLevelAdded(ULevel* Level, UWorld* World)
+{
+	if (World == GetWorld())
+	{
+		RegisterLevelTargets(Level);
+	}
+}
+
+void UALSXTTargetRegistrySubsystem::RegisterLevelTargets(const ULevel* Level)
+{
+	if (!IsValid(Level))
+	{
+		return;
+	}
+
+	for (const auto& Actor : Level->Actors)
+	{
+		OnActorSpawned(Actor);
+	}
+}
+
+void UALSXTTargetRegistrySubsystem::RefreshTargets()
+{
+	if (RefreshFrame == GFrameCounter)
+	{
+		return;
+	}
+
+	RefreshFrame = GFrameCounter;
+
+	// Backwards, because removed targets are replaced by the last one.
+	for (auto i{Targets.Num() - 1}; i >= 0; i--)
+	{
+		auto& Target{Targets[i]};
+		const auto* Actor{Target.Actor.Get()};
+
+		if (!IsValid(Actor) || Actor->IsActorBeingDestroyed())
+		{
+			RemoveTargetAt(i);
+			continue;
+		}
+
+		Target.Location = Actor->GetActorLocation();
+
+		const auto NewCell{GetCell(Target.Location)};
+
+		if (NewCell != Target.Cell)
+		{
+			RemoveFromCell(Target.Cell, i);
+			AddToCell(NewCell, i);
+			Target.Cell = NewCell;
+		}
+	}
+}
+
+void UALSXTTargetRegistrySubsystem::RemoveTargetAt(const int32 TargetIndex)
+{
+	RemoveFromCell(Targets[TargetIndex].Cell, TargetIndex);
+	TargetIndices.Remove(Targets[TargetIndex].Key);
+
+	const auto LastIndex{Targets.Num() - 1};
+
+	if (TargetIndex != LastIndex)
+	{
+		// The last target takes the place of the removed one.
+		const auto& LastTarget{Targets[LastIndex]};
+
+		RemoveFromCell(LastTarget.Cell, LastIndex);
+		AddToCell(LastTarget.Cell, TargetIndex);
+		TargetIndices.Add(LastTarget.Key, TargetIndex);
+	}
+
+	Targets.RemoveAtSwap(TargetIndex, 1, false);
+}
+
+void UALSXTTargetRegistrySubsystem::AddToCell(const FIntPoint& Cell, const int32 TargetIndex)
+{
+	Cells.FindOrAdd(Cell).Add(TargetIndex);
+}
+
+void UALSXTTargetRegistrySubsystem::RemoveFromCell(const FIntPoint& Cell, const int32 TargetIndex)
+{
+	auto* CellTargets{Cells.Find(Cell)};
+
+	if (CellTargets == nullptr)
+	{
+		return;
+	}
+
+	CellTargets->RemoveSingleSwap(TargetIndex, false);
+
+	// Empty cells are dropped, otherwise the map would keep every cell a target ever passed through.
+	if (CellTargets->IsEmpty())
+	{
+		Cells.Remove(Cell);
+	}
+}
+
+FIntPoint UALSXTTargetRegistrySubsystem::GetCell(const FVector& Location) const
+{
+	return {FMath::FloorToInt32(Location.X / CellSize), FMath::FloorToInt32(Location.Y / CellSize)};
+}
@@ -0,0 +1,43 @@
+// MIT
+
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "Utility/ALSXTGameplayTags.h"
+#include "Utility/ALSXTSoundTagTable.h"
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FALSXTSoundTagTableTest, "ALSXT.SoundTagTable.SelectSoundIndex",
+                                 EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FALSXTSoundTagTableTest::RunTest(const FString& Parameters)
+{
+	struct FTestSound
+	{
+		TArray<FGameplayTag> FirstTags;
+
+		TArray<FGameplayTag> SecondTags;
+	};
+
+	const FGameplayTag Front{ALSXTImpactSideTags::Front};
+	const FGameplayTag Back{ALSXTImpactSideTags::Back};
+
+	// The first sound has no second tags, like sounds with an empty damage list.
+	const TArray<FTestSound> Sounds{{{Front}, {}}, {{Back}, {Front}}};
+
+	FALSXTSoundTagTable Table;
+	Table.Compile(Sounds, &FTestSound::FirstTags, &FTestSound::SecondTags);
+
+	TestEqual(TEXT("Untagged second list matches an empty second tag"), Table.SelectSoundIndex(Front, FGameplayTag::EmptyTag), 0);
+	TestEqual(TEXT("Tagged second list matches an empty second tag"), Table.SelectSoundIndex(Back, FGameplayTag::EmptyTag), 1);
+	TestEqual(TEXT("Both tags match"), Table.SelectSoundIndex(Back, Front), 1);
+	TestEqual(TEXT("Untagged second list does not match a second tag"), Table.SelectSoundIndex(Front, Front), INDEX_NONE);
+	TestEqual(TEXT("Unknown tag matches nothing"), Table.SelectSoundIndex(Front, Back), INDEX_NONE);
+	TestNotEqual(TEXT("Empty tags match any sound"), Table.SelectSoundIndex(FGameplayTag::EmptyTag, FGameplayTag::EmptyTag),
+	             static_cast<int32>(INDEX_NONE));
+	TestEqual(TEXT("The previous sound is picked when it is the only match"), Table.SelectSoundIndex(Front, FGameplayTag::EmptyTag, 0), 0);
+
+	return true;
+}
+
+#endif
@@ -0,0 +1,81 @@
+// MIT
+
+#include "Utility/ALSXTEffectsPreloader.h"
+
+#include "Engine/AssetManager.h"
+
+void FALSXTEffectsPreloader::Request(TArray<FSoftObjectPath>&& NewAssetPaths, const FString& DebugName)
+{
+	NewAssetPaths.RemoveAll([](const FSoftObjectPath& Path)
+	{
+		return Path.IsNull();
+	});
+
+	NewAssetPaths.Sort([](const FSoftObjectPath& A, const FSoftObjectPath& B)
+	{
+		return A.LexicalLess(B);
+	});
+
+	if (bRequested && NewAssetPaths == AssetPaths)
+	{
+		return;
+	}
+
+	Release();
+
+	AssetPaths = MoveTemp(NewAssetPaths);
+	bRequested = true;
+
+	if (AssetPaths.Num() > 0 && UAssetManager::IsInitialized())
+	{
+		Handle = UAssetManager::GetStreamableManager().RequestAsyncLoad(AssetPaths, FStreamableDelegate{},
+		                                                                FStreamableManager::DefaultAsyncLoadPriority,
+		                                                                false, false, DebugName);
+	}
+}
+
+void FALSXTEffectsPreloader::Release()
+{
+	if (Handle.IsValid())
+	{
+		Handle->ReleaseHandle();
+		Handle.Reset();
+	}
+
+	AssetPaths.Reset();
+	bRequested = false;
+}
+
+FALSXTEffectsPreloadInfo FALSXTEffectsPreloader::GetInfo() const
+{
+	FALSXTEffectsPreloadInfo Info;
+	Info.NumAssets = AssetPaths.Num();
+
+	for (const auto& Path : AssetPaths)
+	{
+		auto* Asset{Path.ResolveObject()};
+
+		if (IsValid(Asset))
+		{
+			Info.NumLoadedAssets += 1;
+			Info.MemoryBytes += Asset->GetResourceSizeBytes(EResourceSizeMode::EstimatedTotal);
+		}
+	}
+
+	if (!bRequested)
+	{
+		Info.Status = EALSXTEffectsPreloadStatus::NotRequested;
+	}
+	else if (Handle.IsValid() && Handle->IsLoadingInProgress())
+	{
+		Info.Status = EALSXTEffectsPreloadStatus::Loading;
+	}
+	else
+	{
+		Info.Status = Info.NumLoadedAssets < Info.NumAssets
+			              ? EALSXTEffectsPreloadStatus::Incomplete
+			              : EALSXTEffectsPreloadStatus::Loaded;
+	}
+
+	return Info;
+}
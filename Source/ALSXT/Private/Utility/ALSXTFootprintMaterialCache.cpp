@@ -0,0 +1,179 @@
+// MIT
+
+#include "Utility/ALSXTFootprintMaterialCache.h"
+
+#include "Materials/MaterialInstanceDynamic.h"
+
+namespace ALSXTFootprintMaterialCache
+{
+	static const FMaterialParameterInfo& GetTextureParameterInfo(const int32 Index)
+	{
+		static const FMaterialParameterInfo ParameterInfos[]
+		{
+			FMaterialParameterInfo{TEXT("SoleTexture")},
+			FMaterialParameterInfo{TEXT("SoleNormal")},
+			FMaterialParameterInfo{TEXT("SoleDetail")},
+			FMaterialParameterInfo{TEXT("TransferDetailTexture")},
+			FMaterialParameterInfo{TEXT("TransferDetailNormal")},
+			FMaterialParameterInfo{TEXT("TransferDetailTexturePrevious")},
+			FMaterialParameterInfo{TEXT("TransferDetailNormalPrevious")}
+		};
+
+		static_assert(UE_ARRAY_COUNT(ParameterInfos) == static_cast<uint8>(EALSXTFootprintTextureParameter::Count));
+
+		return ParameterInfos[Index];
+	}
+
+	static const FName& GetScalarParameterName(const int32 Index)
+	{
+		static const FName ParameterNames[]
+		{
+			TEXT("SoleNormalScale"),
+			TEXT("TransferNormalScale"),
+			TEXT("TransferDetailScale"),
+			TEXT("Opacity"),
+			TEXT("GrainSize"),
+			TEXT("Wetness"),
+			TEXT("EmissiveAmount"),
+			TEXT("TransferNormalScalePrevious"),
+			TEXT("TransferDetailScalePrevious"),
+			TEXT("GrainSizePrevious"),
+			TEXT("WetnessPrevious"),
+			TEXT("EmissiveAmountPrevious"),
+			TEXT("PhaseAlpha"),
+			TEXT("TransferAmount"),
+			TEXT("SurfaceTransferAmount"),
+			TEXT("TransferAmountPrevious"),
+			TEXT("SurfaceTransferAmountPrevious")
+		};
+
+		static_assert(UE_ARRAY_COUNT(ParameterNames) == static_cast<uint8>(EALSXTFootprintScalarParameter::Count));
+
+		return ParameterNames[Index];
+	}
+
+	static const FName& GetVectorParameterName(const int32 Index)
+	{
+		static const FName ParameterNames[]
+		{
+			TEXT("PrimaryColor"),
+			TEXT("SecondaryColor"),
+			TEXT("PrimaryColorPrevious"),
+			TEXT("SecondaryColorPrevious")
+		};
+
+		static_assert(UE_ARRAY_COUNT(ParameterNames) == static_cast<uint8>(EALSXTFootprintVectorParameter::Count));
+
+		return ParameterNames[Index];
+	}
+}
+
+FALSXTFootprintMaterialCacheEntry::FALSXTFootprintMaterialCacheEntry()
+{
+	for (auto& Index : ScalarIndices)
+	{
+		Index = INDEX_NONE;
+	}
+
+	for (auto& Index : VectorIndices)
+	{
+		Index = INDEX_NONE;
+	}
+}
+
+UMaterialInstanceDynamic* FALSXTFootprintMaterialCache::GetMaterial(UObject* Outer, UMaterialInterface* ParentMaterial,
+                                                                   const EALSXTFootBone Foot, const EPhysicalSurface SurfaceType,
+                                                                   const FALSXTFootprintMaterialParameters& Parameters)
+{
+	if (!IsValid(ParentMaterial))
+	{
+		return nullptr;
+	}
+
+	auto* Entry{
+		Entries.FindByPredicate([Foot, SurfaceType](const FALSXTFootprintMaterialCacheEntry& CacheEntry)
+		{
+			return CacheEntry.Foot == Foot && CacheEntry.SurfaceType == SurfaceType;
+		})
+	};
+
+	if (Entry == nullptr)
+	{
+		Entry = &Entries.AddDefaulted_GetRef();
+		Entry->Foot = Foot;
+		Entry->SurfaceType = SurfaceType;
+	}
+
+	if (IsValid(Entry->Material) && Entry->ParentMaterial == ParentMaterial)
+	{
+		ApplyParameters(*Entry, Parameters, false);
+		return Entry->Material;
+	}
+
+	// First footprint for this foot and surface, or the surface now uses another decal material.
+	*Entry = FALSXTFootprintMaterialCacheEntry{};
+	Entry->Foot = Foot;
+	Entry->SurfaceType = SurfaceType;
+	Entry->ParentMaterial = ParentMaterial;
+	Entry->Material = UMaterialInstanceDynamic::Create(ParentMaterial, Outer);
+
+	if (IsValid(Entry->Material))
+	{
+		ApplyParameters(*Entry, Parameters, true);
+	}
+
+	return Entry->Material;
+}
+
+void FALSXTFootprintMaterialCache::Reset()
+{
+	Entries.Reset();
+}
+
+void FALSXTFootprintMaterialCache::ApplyParameters(FALSXTFootprintMaterialCacheEntry& Entry,
+                                                   const FALSXTFootprintMaterialParameters& Parameters, const bool bForce)
+{
+	auto* Material{Entry.Material.Get()};
+	auto& Values{Entry.Values};
+
+	for (auto i{0}; i < static_cast<uint8>(EALSXTFootprintTextureParameter::Count); i++)
+	{
+		if (bForce || Values.Textures[i] != Parameters.Textures[i])
+		{
+			Values.Textures[i] = Parameters.Textures[i];
+			Material->SetTextureParameterValueByInfo(ALSXTFootprintMaterialCache::GetTextureParameterInfo(i), Values.Textures[i]);
+		}
+	}
+
+	for (auto i{0}; i < static_cast<uint8>(EALSXTFootprintScalarParameter::Count); i++)
+	{
+		if (!bForce && Values.Scalars[i] == Parameters.Scalars[i])
+		{
+			continue;
+		}
+
+		Values.Scalars[i] = Parameters.Scalars[i];
+
+		if (Entry.ScalarIndices[i] == INDEX_NONE || !Material->SetScalarParameterByIndex(Entry.ScalarIndices[i], Values.Scalars[i]))
+		{
+			Material->InitializeScalarParameterAndGetIndex(ALSXTFootprintMaterialCache::GetScalarParameterName(i),
+			                                               Values.Scalars[i], Entry.ScalarIndices[i]);
+		}
+	}
+
+	for (auto i{0}; i < static_cast<uint8>(EALSXTFootprintVectorParameter::Count); i++)
+	{
+		if (!bForce && Values.Vectors[i] == Parameters.Vectors[i])
+		{
+			continue;
+		}
+
+		Values.Vectors[i] = Parameters.Vectors[i];
+
+		if (Entry.VectorIndices[i] == INDEX_NONE || !Material->SetVectorParameterByIndex(Entry.VectorIndices[i], Values.Vectors[i]))
+		{
+			Material->InitializeVectorParameterAndGetIndex(ALSXTFootprintMaterialCache::GetVectorParameterName(i),
+			                                               Values.Vectors[i], Entry.VectorIndices[i]);
+		}
+	}
+}
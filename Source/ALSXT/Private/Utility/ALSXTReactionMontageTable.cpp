@@ -0,0 +1,198 @@
+// MIT
+
+#include "Utility/ALSXTReactionMontageTable.h"
+
+#include "Math/RandomStream.h"
+
+void FALSXTReactionHistory::Add(const UAnimMontage* Montage)
+{
+	Montages[NextIndex] = Montage;
+	NextIndex = (NextIndex + 1) % Capacity;
+}
+
+void FALSXTReactionHistory::Reset()
+{
+	for (auto& Montage : Montages)
+	{
+		Montage = nullptr;
+	}
+
+	NextIndex = 0;
+}
+
+const UAnimMontage* FALSXTReactionHistory::GetRecent(const int32 Age) const
+{
+	return Montages[(NextIndex - 1 - Age + Capacity * 2) % Capacity];
+}
+
+void FALSXTReactionMontageTable::Compile(const TArray<FImpactReactionLocation>& Locations)
+{
+	Montages.Reset();
+	Entries.Reset();
+	EntryIndices.Reset();
+
+	for (const auto& Location : Locations)
+	{
+		for (const auto& Strength : Location.ImpactReactionStrengths)
+		{
+			for (const auto& Side : Strength.ImpactReactionSides)
+			{
+				for (const auto& Form : Side.ImpactReactionForms)
+				{
+					const FALSXTReactionKey Key{
+						Location.ImpactReactionLocation, Strength.ImpactReactionStrength, Side.ImpactReactionSide, Form.ImpactReactionForm
+					};
+
+					// The first matching entry wins, as it did when the arrays were searched linearly.
+					if (EntryIndices.Contains(Key))
+					{
+						continue;
+					}
+
+					auto& Entry{Entries.AddDefaulted_GetRef()};
+					Entry.FallbackMontage = Form.DefaultFallbackMontage.Montage;
+
+					Entry.FirstRegularMontage = Montages.Num();
+					Entry.NumRegularMontages = Form.RegularMontages.Num();
+
+					for (const auto& MontageInfo : Form.RegularMontages)
+					{
+						Montages.Add(MontageInfo.Montage);
+					}
+
+					Entry.FirstBlockingMontage = Montages.Num();
+					Entry.NumBlockingMontages = Form.BlockingMontages.Num();
+
+					for (const auto& MontageInfo : Form.BlockingMontages)
+					{
+						Montages.Add(MontageInfo.Montage);
+					}
+
+					EntryIndices.Add(Key, Entries.Num() - 1);
+				}
+			}
+		}
+	}
+
+	Montages.Shrink();
+	Entries.Shrink();
+	EntryIndices.Shrink();
+	bCompiled = true;
+}
+
+int32 FALSXTReactionMontageTable::FindReaction(const FALSXTReactionKey& Key) const
+{
+	const auto* EntryIndex{EntryIndices.Find(Key)};
+
+	return EntryIndex != nullptr ? *EntryIndex : INDEX_NONE;
+}
+
+UAnimMontage* FALSXTReactionMontageTable::SelectMontage(const FALSXTReactionKey& Key, const bool bBlocking,
+                                                        FRandomStream& RandomStream, FALSXTReactionHistory& History) const
+{
+	const auto ReactionIndex{FindReaction(Key)};
+
+	return GetMontage(ReactionIndex, bBlocking, SelectMontageIndex(ReactionIndex, bBlocking, RandomStream, History));
+}
+
+UAnimMontage* FALSXTReactionMontageTable::GetMontage(const int32 ReactionIndex, const bool bBlocking, const int32 MontageIndex) const
+{
+	if (!Entries.IsValidIndex(ReactionIndex))
+	{
+		return nullptr;
+	}
+
+	const auto& Entry{Entries[ReactionIndex]};
+	const auto FirstMontage{bBlocking ? Entry.FirstBlockingMontage : Entry.FirstRegularMontage};
+	const auto NumMontages{bBlocking ? Entry.NumBlockingMontages : Entry.NumRegularMontages};
+
+	if (MontageIndex >= 0 && MontageIndex < NumMontages)
+	{
+		auto* Montage{Montages[FirstMontage + MontageIndex].Get()};
+
+		if (IsValid(Montage))
+		{
+			return Montage;
+		}
+	}
+
+	return Entry.FallbackMontage.Get();
+}
+
+int32 FALSXTReactionMontageTable::SelectMontageIndex(const int32 ReactionIndex, const bool bBlocking,
+                                                     FRandomStream& RandomStream, FALSXTReactionHistory& History) const
+{
+	if (!Entries.IsValidIndex(ReactionIndex))
+	{
+		return INDEX_NONE;
+	}
+
+	const auto& Entry{Entries[ReactionIndex]};
+	const auto FirstMontage{bBlocking ? Entry.FirstBlockingMontage : Entry.FirstRegularMontage};
+	const auto NumMontages{bBlocking ? Entry.NumBlockingMontages : Entry.NumRegularMontages};
+
+	if (NumMontages <= 0)
+	{
+		return INDEX_NONE;
+	}
+
+	// Exclude recently played montages, most recent first, as long as at least one candidate is left.
+	TBitArray<TInlineAllocator<1>> Excluded{false, NumMontages};
+	auto NumExcluded{0};
+
+	for (auto Age{0}; Age < FALSXTReactionHistory::Capacity; Age++)
+	{
+		const auto* RecentMontage{History.GetRecent(Age)};
+
+		if (RecentMontage == nullptr)
+		{
+			continue;
+		}
+
+		auto NumMatches{0};
+
+		for (auto i{0}; i < NumMontages; i++)
+		{
+			if (!Excluded[i] && Montages[FirstMontage + i].Get() == RecentMontage)
+			{
+				NumMatches += 1;
+			}
+		}
+
+		if (NumMatches <= 0 || NumExcluded + NumMatches >= NumMontages)
+		{
+			continue;
+		}
+
+		for (auto i{0}; i < NumMontages; i++)
+		{
+			if (!Excluded[i] && Montages[FirstMontage + i].Get() == RecentMontage)
+			{
+				Excluded[i] = true;
+			}
+		}
+
+		NumExcluded += NumMatches;
+	}
+
+	// Pick the n-th of the remaining montages.
+	auto CandidateIndex{RandomStream.RandHelper(NumMontages - NumExcluded)};
+	auto MontageIndex{0};
+
+	for (; MontageIndex < NumMontages; MontageIndex++)
+	{
+		if (!Excluded[MontageIndex])
+		{
+			if (CandidateIndex <= 0)
+			{
+				break;
+			}
+
+			CandidateIndex -= 1;
+		}
+	}
+
+	History.Add(Montages[FirstMontage + MontageIndex].Get());
+
+	return MontageIndex;
+}
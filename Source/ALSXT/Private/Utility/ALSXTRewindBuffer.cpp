@@ -0,0 +1,99 @@
+// MIT
+
+#include "Utility/ALSXTRewindBuffer.h"
+
+void FALSXTRewindBuffer::Initialize(const int32 Capacity, const TArray<FName>& NewBoneNames)
+{
+	Samples.Reset();
+	Samples.SetNum(FMath::Max(2, Capacity));
+
+	BoneNames.Reset();
+
+	for (const auto& BoneName : NewBoneNames)
+	{
+		if (BoneNames.Num() >= FALSXTRewindSample::MaxBones)
+		{
+			break;
+		}
+
+		BoneNames.Add(BoneName);
+	}
+
+	NextSampleIndex = 0;
+	NumSamples = 0;
+}
+
+void FALSXTRewindBuffer::Reset()
+{
+	NextSampleIndex = 0;
+	NumSamples = 0;
+}
+
+FALSXTRewindSample& FALSXTRewindBuffer::AddSample(const double Time)
+{
+	auto& Sample{Samples[NextSampleIndex]};
+	Sample.Time = Time;
+
+	NextSampleIndex = (NextSampleIndex + 1) % Samples.Num();
+	NumSamples = FMath::Min(NumSamples + 1, Samples.Num());
+
+	return Sample;
+}
+
+bool FALSXTRewindBuffer::GetSampleAtTime(const double Time, FALSXTRewindSample& Sample) const
+{
+	if (NumSamples <= 0)
+	{
+		return false;
+	}
+
+	const auto Capacity{Samples.Num()};
+	const auto NewestIndex{(NextSampleIndex - 1 + Capacity) % Capacity};
+	const auto OldestIndex{(NextSampleIndex - NumSamples + Capacity) % Capacity};
+
+	if (Time >= Samples[NewestIndex].Time)
+	{
+		Sample = Samples[NewestIndex];
+		return true;
+	}
+
+	if (Time <= Samples[OldestIndex].Time)
+	{
+		Sample = Samples[OldestIndex];
+		return true;
+	}
+
+	// Walk back from the newest sample, the requested time is usually only a few frames old.
+	auto NextIndex{NewestIndex};
+
+	for (auto i{1}; i < NumSamples; i++)
+	{
+		const auto PreviousIndex{(NewestIndex - i + Capacity) % Capacity};
+		const auto& PreviousSample{Samples[PreviousIndex]};
+
+		if (PreviousSample.Time <= Time)
+		{
+			const auto& NextSample{Samples[NextIndex]};
+			const auto TimeDelta{NextSample.Time - PreviousSample.Time};
+			const auto Alpha{TimeDelta > SMALL_NUMBER ? static_cast<float>((Time - PreviousSample.Time) / TimeDelta) : 1.0f};
+
+			Sample.Time = Time;
+			Sample.CapsuleLocation = FMath::Lerp(PreviousSample.CapsuleLocation, NextSample.CapsuleLocation, Alpha);
+			Sample.CapsuleRotation = FQuat::Slerp(PreviousSample.CapsuleRotation, NextSample.CapsuleRotation, Alpha);
+			Sample.CapsuleRadius = FMath::Lerp(PreviousSample.CapsuleRadius, NextSample.CapsuleRadius, Alpha);
+			Sample.CapsuleHalfHeight = FMath::Lerp(PreviousSample.CapsuleHalfHeight, NextSample.CapsuleHalfHeight, Alpha);
+
+			for (auto j{0}; j < BoneNames.Num(); j++)
+			{
+				Sample.BoneLocations[j] = FMath::Lerp(PreviousSample.BoneLocations[j], NextSample.BoneLocations[j], Alpha);
+			}
+
+			return true;
+		}
+
+		NextIndex = PreviousIndex;
+	}
+
+	Sample = Samples[OldestIndex];
+	return true;
+}
@@ -0,0 +1,77 @@
+// MIT
+
+#include "Utility/ALSXTSoundTagTable.h"
+
+int32 FALSXTSoundTagTable::SelectSoundIndex(const FGameplayTag& FirstTag, const FGameplayTag& SecondTag, const int32 PreviousIndex) const
+{
+	const auto bFilterFirstTag{FirstTag.IsValid()};
+	const auto bFilterSecondTag{SecondTag.IsValid()};
+
+	const auto FirstTagMask{bFilterFirstTag ? GetTagMask(FirstTags, FirstTag) : 0};
+	const auto SecondTagMask{bFilterSecondTag ? GetTagMask(SecondTags, SecondTag) : 0};
+
+	if ((bFilterFirstTag && FirstTagMask == 0) || (bFilterSecondTag && SecondTagMask == 0))
+	{
+		return INDEX_NONE;
+	}
+
+	// Sound lists are short, so the candidates live on the stack.
+	TArray<int32, TInlineAllocator<64>> Candidates;
+	auto bPreviousMatches{false};
+
+	for (auto i{0}; i < FirstTagMasks.Num(); i++)
+	{
+		// Sounds without tags in a list only match when that list is not filtered.
+		if ((!bFilterFirstTag || (FirstTagMasks[i] & FirstTagMask) != 0) &&
+		    (!bFilterSecondTag || (SecondTagMasks[i] & SecondTagMask) != 0))
+		{
+			if (i == PreviousIndex)
+			{
+				bPreviousMatches = true;
+			}
+			else
+			{
+				Candidates.Add(i);
+			}
+		}
+	}
+
+	if (Candidates.IsEmpty())
+	{
+		return bPreviousMatches ? PreviousIndex : INDEX_NONE;
+	}
+
+	return Candidates[FMath::RandHelper(Candidates.Num())];
+}
+
+uint64 FALSXTSoundTagTable::CompileTagMask(TArray<FGameplayTag, TInlineAllocator<8>>& Vocabulary, const TArray<FGameplayTag>& Tags)
+{
+	uint64 TagMask{0};
+
+	for (const auto& Tag : Tags)
+	{
+		auto TagIndex{Vocabulary.IndexOfByKey(Tag)};
+
+		if (TagIndex == INDEX_NONE)
+		{
+			// Tag lists are small vocabularies such as the action strengths, more tags than bits are ignored.
+			if (!ensure(Vocabulary.Num() < MaxTags))
+			{
+				continue;
+			}
+
+			TagIndex = Vocabulary.Add(Tag);
+		}
+
+		TagMask |= 1ull << TagIndex;
+	}
+
+	return TagMask;
+}
+
+uint64 FALSXTSoundTagTable::GetTagMask(const TArray<FGameplayTag, TInlineAllocator<8>>& Vocabulary, const FGameplayTag& Tag)
+{
+	const auto TagIndex{Vocabulary.IndexOfByKey(Tag)};
+
+	return TagIndex != INDEX_NONE ? 1ull << TagIndex : 0;
+}
@@ -0,0 +1,148 @@
+// MIT
+
+#include "Utility/ALSXTStructs.h"
+
+#include "Components/SkinnedMeshComponent.h"
+#include "Engine/NetSerialization.h"
+#include "PhysicalMaterials/PhysicalMaterial.h"
+#include "UObject/CoreNet.h"
+
+namespace ALSXTStructs
+{
+	// How the bone of a hit result is sent.
+	static constexpr uint8 NoBone{0};
+	static constexpr uint8 BoneByIndex{1};
+	static constexpr uint8 BoneByName{2};
+
+	static void SerializeTag(FGameplayTag& Tag, FArchive& Archive, UPackageMap* Map, bool& bSuccess)
+	{
+		auto bSuccessLocal{true};
+		Tag.NetSerialize(Archive, Map, bSuccessLocal);
+		bSuccess &= bSuccessLocal;
+	}
+}
+
+bool FExtendedHitResult::NetSerialize(FArchive& Archive, UPackageMap* Map, bool& bSuccess)
+{
+	bSuccess = true;
+
+	uint8 Flags{0};
+
+	if (Archive.IsSaving())
+	{
+		Flags = (Hit ? 1 : 0) | (HitResult.bBlockingHit ? 2 : 0);
+	}
+
+	Archive.SerializeBits(&Flags, 2);
+
+	if (Archive.IsLoading())
+	{
+		Hit = (Flags & 1) != 0;
+		HitResult.bBlockingHit = (Flags & 2) != 0;
+	}
+
+	Archive << Mass;
+	Archive << Velocity;
+
+	bSuccess &= SerializeFixedVector<1, 16>(Direction, Archive);
+	bSuccess &= SerializePackedVector<10, 24>(Impulse, Archive);
+
+	ALSXTStructs::SerializeTag(DamageType, Archive, Map, bSuccess);
+
+	Archive << HitResult.HitObjectHandle;
+	Archive << HitResult.Component;
+	Archive << HitResult.PhysMaterial;
+
+	bSuccess &= SerializePackedVector<1, 24>(HitResult.Location, Archive);
+	bSuccess &= SerializePackedVector<1, 24>(HitResult.ImpactPoint, Archive);
+	bSuccess &= SerializeFixedVector<1, 16>(HitResult.ImpactNormal, Archive);
+
+	// Bones of the hit skinned mesh are sent as an index, other bone names as names.
+	const auto* SkinnedMesh{Cast<USkinnedMeshComponent>(HitResult.Component.Get())};
+
+	auto BoneSerialization{ALSXTStructs::NoBone};
+	uint32 BoneIndex{0};
+
+	if (Archive.IsSaving() && HitResult.BoneName != NAME_None)
+	{
+		const auto MeshBoneIndex{IsValid(SkinnedMesh) ? SkinnedMesh->GetBoneIndex(HitResult.BoneName) : INDEX_NONE};
+
+		if (MeshBoneIndex != INDEX_NONE)
+		{
+			BoneSerialization = ALSXTStructs::BoneByIndex;
+			BoneIndex = static_cast<uint32>(MeshBoneIndex);
+		}
+		else
+		{
+			BoneSerialization = ALSXTStructs::BoneByName;
+		}
+	}
+
+	Archive.SerializeBits(&BoneSerialization, 2);
+
+	switch (BoneSerialization)
+	{
+		case ALSXTStructs::BoneByIndex:
+			Archive.SerializeIntPacked(BoneIndex);
+
+			if (Archive.IsLoading())
+			{
+				// The mesh may not be resolved yet on this machine, in which case the bone is lost.
+				HitResult.BoneName = IsValid(SkinnedMesh) ? SkinnedMesh->GetBoneName(static_cast<int32>(BoneIndex)) : NAME_None;
+			}
+			break;
+
+		case ALSXTStructs::BoneByName:
+			UPackageMap::StaticSerializeName(Archive, HitResult.BoneName);
+			break;
+
+		default:
+			if (Archive.IsLoading())
+			{
+				HitResult.BoneName = NAME_None;
+			}
+			break;
+	}
+
+	return true;
+}
+
+bool FDoubleHitResult::NetSerialize(FArchive& Archive, UPackageMap* Map, bool& bSuccess)
+{
+	bSuccess = true;
+
+	ALSXTStructs::SerializeTag(CollisionType, Archive, Map, bSuccess);
+	ALSXTStructs::SerializeTag(ImpactType, Archive, Map, bSuccess);
+	ALSXTStructs::SerializeTag(ImpactForm, Archive, Map, bSuccess);
+	ALSXTStructs::SerializeTag(ImpactLocation, Archive, Map, bSuccess);
+	ALSXTStructs::SerializeTag(ImpactSide, Archive, Map, bSuccess);
+	ALSXTStructs::SerializeTag(Strength, Archive, Map, bSuccess);
+
+	auto bSuccessLocal{true};
+
+	HitResult.NetSerialize(Archive, Map, bSuccessLocal);
+	bSuccess &= bSuccessLocal;
+
+	OriginHitResult.NetSerialize(Archive, Map, bSuccessLocal);
+	bSuccess &= bSuccessLocal;
+
+	return true;
+}
+
+bool FAttackDoubleHitResult::NetSerialize(FArchive& Archive, UPackageMap* Map, bool& bSuccess)
+{
+	bSuccess = true;
+
+	ALSXTStructs::SerializeTag(Overlay, Archive, Map, bSuccess);
+	ALSXTStructs::SerializeTag(Type, Archive, Map, bSuccess);
+	ALSXTStructs::SerializeTag(Strength, Archive, Map, bSuccess);
+
+	Archive << BaseDamage;
+
+	auto bSuccessLocal{true};
+
+	DoubleHitResult.NetSerialize(Archive, Map, bSuccessLocal);
+	bSuccess &= bSuccessLocal;
+
+	return true;
+}
@@ -11,6 +11,8 @@
 #include "Engine/EngineTypes.h"
 #include "Utility/ALSXTStructs.h"
 #include "State/ALSXTFootstepState.h"
+#include "Utility/ALSXTFootprintMaterialCache.h"
+#include "Utility/ALSXTRewindBuffer.h"
 #include "State/ALSXTDefensiveModeState.h"
 #include "State/ALSXTSlidingState.h"
 #include "ALSXTCharacter.generated.h"
@@ -70,9 +72,15 @@ private:
 
 	// Footstep State
 
-	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Settings|Als Character|Footstep State", ReplicatedUsing = "OnReplicate_FootprintsState", Meta = (AllowPrivateAccess))
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Settings|Als Character|Footstep State", Meta = (AllowPrivateAccess))
 	FALSXTFootprintsState FootprintsState;
 
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "State|Als Character", Transient, ReplicatedUsing = "OnReplicate_FootprintsNetState", Meta = (AllowPrivateAccess))
+	FALSXTFootprintsNetState FootprintsNetState;
+
+	UPROPERTY(Transient)
+	FALSXTFootprintMaterialCache FootprintMaterialCache;
+
 	// Freelooking
 
 	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Settings|Als Character|Desired State", Replicated, Meta = (AllowPrivateAccess))
@@ -195,8 +203,24 @@ protected:
 
 	// Attack Trace Settings
 
-	FTimerHandle AttackTraceTimerHandle;	// Timer Handle for Attack Trace
-	FTimerDelegate AttackTraceTimerDelegate; // Delegate to bind function with parameters
+	bool bAttackCollisionTraceActive{false};
+
+	// Whether AttackTraceSettings already holds a sample to sweep from.
+	bool bHasAttackTraceSample{false};
+
+	// Built once per trace session in BeginAttackCollisionTrace().
+	FCollisionObjectQueryParams AttackTraceObjectQueryParameters;
+
+	FCollisionQueryParams AttackTraceQueryParameters;
+
+	// Scratch buffers that keep their memory between trace sessions. The hit array stays a plain TArray because the
+	// world sweep queries only accept the default allocator, it is reserved once instead.
+	TArray<FHitResult> AttackTraceHits;
+
+	TSet<TWeakObjectPtr<AActor>, DefaultKeyFuncs<TWeakObjectPtr<AActor>>, TInlineSetAllocator<8>> AttackTraceHitActors;
+
+	// Recent poses of this character, recorded on the server for attack hit validation.
+	FALSXTRewindBuffer RewindBuffer;
 
 public:
 	virtual void Tick(float DeltaTime) override;
@@ -204,7 +228,8 @@ public:
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "State|Als Character", Meta = (AllowPrivateAccess))
 	FALSXTCombatAttackTraceSettings AttackTraceSettings;
 
-	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "State|Als Character", Meta = (AllowPrivateAccess))
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "State|Als Character",
+		Meta = (AllowPrivateAccess, DeprecatedProperty, DeprecationMessage = "Still filled with the actors hit in the current attack trace, but no longer used for the hit checks and will be removed."))
 	TArray<AActor*> AttackTraceLastHitActors;
 
 private:
@@ -624,21 +649,23 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "ALS|Movement System")
 	const FALSXTFootprintsState& GetFootprintsState() const;
 
+	FALSXTFootprintMaterialCache& GetFootprintMaterialCache();
+
 	UFUNCTION(BlueprintCallable, Category = "ALS|Als Character", Meta = (AutoCreateRefTerm = "NewFootprintsState"))
 	void SetFootprintsState(const EALSXTFootBone& Foot, const FALSXTFootprintsState& NewFootprintsState);
 
 	UFUNCTION(BlueprintCallable, BlueprintImplementableEvent, Category = "ALS|Als Character", Meta = (AutoCreateRefTerm = "NewFootprintsState"))
 	FALSXTFootprintsState ProcessNewFootprintsState(const EALSXTFootBone& Foot, const FALSXTFootprintsState& NewFootprintsState);
 
-	UFUNCTION(Server, Unreliable)
-	void ServerProcessNewFootprintsState(const EALSXTFootBone& Foot, const FALSXTFootprintsState& NewFootprintsState);
-
 private:
-	UFUNCTION(Server, Unreliable)
-	void ServerSetFootprintsState(const EALSXTFootBone& Foot, const FALSXTFootprintsState& NewFootprintsState);
+	// Reliable, since it is only sent when the state changes and a lost update would never be sent again.
+	UFUNCTION(Server, Reliable)
+	void ServerSetFootprintsNetState(const FALSXTFootprintsNetState& NewFootprintsNetState);
+
+	void SetFootprintsNetState(const FALSXTFootprintsNetState& NewFootprintsNetState);
 
 	UFUNCTION()
-	void OnReplicate_FootprintsState(const FALSXTFootprintsState& PreviousFootprintsState);
+	void OnReplicate_FootprintsNetState(const FALSXTFootprintsNetState& PreviousFootprintsNetState);
 
 protected:
 	UFUNCTION(BlueprintNativeEvent, Category = "ALS|Als Character")
@@ -1002,9 +1029,43 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "ALS|Als Character", Category = "ALS|Als Character")
 	void AttackCollisionTrace();
 
+	// Sweeps the attack trace over the path travelled since the previous sample. Called by the
+	// attack trace notify states on every animation update with the current trace locations.
+	UFUNCTION(BlueprintCallable, Category = "ALS|Als Character")
+	void UpdateAttackCollisionTrace(const FVector& Start, const FVector& End, float Radius);
+
+	bool IsAttackCollisionTraceActive() const;
+
+	const FALSXTRewindBuffer& GetRewindBuffer() const;
+
+	// Checks a hit claimed by the attacking client against the victim's recorded pose at the claimed time.
+	bool ValidateAttackHit(const FALSXTAttackHitClaim& Claim) const;
+
 	UFUNCTION(BlueprintCallable, Category = "ALS|Als Character", Category = "ALS|Als Character")
 	void EndAttackCollisionTrace();
 
+private:
+	void ProcessAttackCollisionHits();
+
+	// Fills in the attack hit from this character's attack state. The origin trace sweeps back towards the trace start.
+	FAttackDoubleHitResult MakeAttackHitResult(const FHitResult& HitResult, const FVector& TraceStart, float TraceRadius);
+
+	UFUNCTION(Server, Reliable)
+	void ServerConfirmAttackHit(const FALSXTAttackHitClaim& Claim);
+
+	// True on the server for characters whose attacks are traced by their owning client.
+	bool IsAttackTracedRemotely() const;
+
+	bool ShouldRecordRewindSamples() const;
+
+	void RecordRewindSample();
+
+	double GetServerWorldTime() const;
+
+	// Estimates the server world time of the victim pose this client currently renders.
+	double GetRenderedPoseServerTime(const AActor* Victim) const;
+
+public:
 	UFUNCTION(BlueprintCallable, BlueprintImplementableEvent, Category = "ALS|Als Character")
 	void OnAttackCollision(FAttackDoubleHitResult Hit);
 
@@ -1312,6 +1373,11 @@ inline const FALSXTFootprintsState& AALSXTCharacter::GetFootprintsState() const
 	return FootprintsState;
 }
 
+inline FALSXTFootprintMaterialCache& AALSXTCharacter::GetFootprintMaterialCache()
+{
+	return FootprintMaterialCache;
+}
+
 inline const FALSXTDefensiveModeState& AALSXTCharacter::GetDefensiveModeState() const
 {
 	return DefensiveModeState;
@@ -1535,4 +1601,14 @@ inline const FGameplayTag& AALSXTCharacter::GetDesiredWeaponObstruction() const
 inline const FGameplayTag& AALSXTCharacter::GetWeaponObstruction() const
 {
 	return WeaponObstruction;
-}
\ No newline at end of file
+}
+
+inline bool AALSXTCharacter::IsAttackCollisionTraceActive() const
+{
+	return bAttackCollisionTraceActive;
+}
+
+inline const FALSXTRewindBuffer& AALSXTCharacter::GetRewindBuffer() const
+{
+	return RewindBuffer;
+}
@@ -32,10 +32,7 @@ protected:
 	UFUNCTION(BlueprintCallable, BlueprintImplementableEvent, Category = "ALS|Als Character")
 	bool ShouldPlayDeathSoundModeration();
 
-public:	
-	// Called every frame
-	virtual void TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction) override;
-
+public:
 	UPROPERTY(BlueprintReadOnly, Category = "ALS|Als Character", Meta = (AllowPrivateAccess))
 	AALSXTCharacter* Character{ Cast<AALSXTCharacter>(GetOwner()) };
 
@@ -54,6 +51,10 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Settings", Meta = (AllowPrivateAccess))
 	FVector2D DamageSoundDelay { 1.0f, 2.0f };
 
+	// Sounds are only sent to and played for players whose view is within this distance.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Settings", Meta = (AllowPrivateAccess, ClampMin = 0, ForceUnits = "cm"))
+	float AudibleDistance { 4000.0f };
+
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Settings", Meta = (AllowPrivateAccess))
 	bool DebugMode { false };
 
@@ -100,39 +101,38 @@ public:
 	void PlayDeathSound(const FGameplayTag& Strength, const FGameplayTag& AttackForm, const float Damage);
 
 private:
-	FTimerHandle TimeSinceLastActionSoundTimer;
-	float TimeSinceLastActionSound;
-	FTimerHandle TimeSinceLastAttackSoundTimer;
-	float TimeSinceLastAttackSound;
-	FTimerHandle TimeSinceLastDamageSoundTimer;
-	float TimeSinceLastDamageSound;
-	float TargetActionSoundDelay{ 1.0f };
-	float CurrentActionSoundDelay{ 10.0f };
-	float TargetAttackSoundDelay{ 1.0f };
-	float CurrentAttackSoundDelay{ 10.0f };
-	float TargetDamageSoundDelay{ 1.0f };
-	float CurrentDamageSoundDelay{ 10.0f };
-	FALSXTCharacterActionSound LastCharacterActionSound;
-	FALSXTCharacterActionSound LastCharacterAttackSound;
-	FALSXTCharacterDamageSound LastCharacterDamageSound;
+	// World times at which the last sounds were played, compared against a delay rolled when they were played.
+	double LastActionSoundTime{ 0.0 };
+	float CurrentActionSoundDelay{ 0.0f };
+	double LastAttackSoundTime{ 0.0 };
+	float CurrentAttackSoundDelay{ 0.0f };
+	double LastDamageSoundTime{ 0.0 };
+	float CurrentDamageSoundDelay{ 0.0f };
+	int32 LastActionSoundIndex{ INDEX_NONE };
+	int32 LastAttackSoundIndex{ INDEX_NONE };
+	int32 LastDamageSoundIndex{ INDEX_NONE };
+	int32 LastDeathSoundIndex{ INDEX_NONE };
+	uint8 SoundEventSequence{ 0 };
+	uint8 LastReceivedSoundSequence{ 0 };
+	bool bReceivedSoundEvent{ false };
 
 	bool ShouldPlayActionSound(const FGameplayTag& Strength, const float Stamina);
 	bool ShouldPlayAttackSound(const FGameplayTag& AttackMethod, const FGameplayTag& Strength, const float Stamina);
 	bool ShouldPlayDamageSound(const FGameplayTag& AttackMethod, const FGameplayTag& Strength, const FGameplayTag& AttackForm, const float Damage);	
-	void StartTimeSinceLastActionSoundTimer(const float Delay);
-	void IncrementTimeSinceLastActionSound();
-	void ResetTimeSinceLastActionSoundTimer();
-	void StartTimeSinceLastAttackSoundTimer(const float Delay);
-	void IncrementTimeSinceLastAttackSound();
-	void ResetTimeSinceLastAttackSoundTimer();
-	void StartTimeSinceLastDamageSoundTimer(const float Delay);
-	void IncrementTimeSinceLastDamageSound();
-	void ResetTimeSinceLastDamageSoundTimer();
-	void PlaySound(FALSXTCharacterSound Sound);
-
-	UFUNCTION(Server, Reliable)
-	void ServerPlaySound(FALSXTCharacterSound Sound);
-
-	UFUNCTION(NetMulticast, Reliable)
-	void MulticastPlaySound(FALSXTCharacterSound Sound);
+	bool IsSoundCooldownElapsed(double LastSoundTime, float Delay) const;
+	void StartSoundCooldown(double& LastSoundTime, float& Delay, const FVector2D& DelayRange) const;
+	void PlaySound(const FALSXTCharacterSound& Sound);
+	void PlaySoundEvent(UALSXTCharacterSoundSettings* Settings, EALSXTCharacterSoundType Type, int32 SoundIndex);
+	void BroadcastSoundEvent(FALSXTCharacterSoundEvent Event);
+	// The listener may have moved since the server sent the sound.
+	bool IsAudibleLocally(const FVector& Location) const;
+
+	UFUNCTION(Server, Unreliable)
+	void ServerPlaySoundEvent(FALSXTCharacterSoundEvent Event);
+
+	// Called on the pawn of the listening player, the event is played by the source component.
+	UFUNCTION(Client, Unreliable)
+	void ClientPlaySoundEvent(UALSXTCharacterSoundComponent* Source, FALSXTCharacterSoundEvent Event);
+
+	void ReceiveSoundEvent(const FALSXTCharacterSoundEvent& Event);
 };
@@ -161,7 +161,18 @@ private:
 	FTimerHandle TargetTraceTimerHandle;
 	FTimerDelegate TargetTraceTimerDelegate;
 
-	TArray<UMaterialInstanceDynamic*> TargetDynamicMaterials;
+	FVector LastObstructionCheckLocation{ForceInit};
+
+	FVector LastObstructionCheckTargetLocation{ForceInit};
+
+	bool bHasTargetObstructionCheck{false};
+
+	FGameplayTag TargetTrackingOverlayMode;
+
+	// Scratch buffers for target registry queries, kept to avoid reallocating them on every query.
+	TArray<AActor*> TargetQueryActors;
+
+	TArray<FVector> TargetQueryLocations;
 
 	FTimerHandle LastTargetsTimerHandle;
 
@@ -169,6 +180,15 @@ private:
 
 	TArray<FLastTargetEntry> LastTargets;
 
+	// Index into the montages of the attack settings, so that the same montage is not picked twice in a row.
+	int32 LastAttackMontageIndex{INDEX_NONE};
+
+	TWeakObjectPtr<const UALSXTCombatSettings> LastAttackMontageSettings;
+
+	// Incremented for every started attack. Montage events are queued, and the events of an interrupted attack montage
+	// carry the serial of their attack, so that they are ignored once a new attack has started.
+	uint32 AttackSerial{0};
+
 	FTimerHandle TimeSinceLastBlockTimerHandle;
 	float TimeSinceLastBlock;
 
@@ -183,10 +203,29 @@ private:
 
 	void StartAttackImplementation(UAnimMontage* Montage, float PlayRate, float StartYawAngle, float TargetYawAngle);
 
+	// The component only ticks while an attack is active or a target is tracked.
+	void RefreshTickEnabled();
+
+	void SetAttackPhase(EALSXTAttackPhase NewPhase);
+
+	void OnAttackMontageBlendingOut(UAnimMontage* Montage, bool bInterrupted, uint32 Serial);
+
+	void OnAttackMontageEnded(UAnimMontage* Montage, bool bInterrupted, uint32 Serial);
+
 	void RefreshAttack(float DeltaTime);
 
 	void RefreshAttackPhysics(float DeltaTime);
 
+	void SetTargetHighlighted(const AActor* TargetActor, bool bHighlighted) const;
+
+	void StartTargetTracking();
+
+	bool IsTargetTracking() const;
+
+	bool ShouldRecheckTargetObstruction(const AActor* TargetActor);
+
+	void RefreshTargetRotation(float DeltaTime);
+
 public:
 	UFUNCTION(BlueprintCallable, Category = "ALS|Als Character")
 	void StopAttack();
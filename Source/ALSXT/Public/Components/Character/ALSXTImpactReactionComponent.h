@@ -13,6 +13,7 @@
 #include "NiagaraFunctionLibrary.h"
 #include "Components/AudioComponent.h" 
 #include "Settings/ALSXTImpactReactionSettings.h"
+#include "Utility/ALSXTReactionMontageTable.h"
 #include "State/ALSXTImpactReactionState.h" 
 #include "Components/TimelineComponent.h"
 #include "ALSXTImpactReactionComponent.generated.h"
@@ -31,9 +32,6 @@ protected:
 	virtual void BeginPlay() override;
 
 public:	
-	// Called every frame
-	virtual void TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction) override;
-
 	AALSXTCharacter* Character{ Cast<AALSXTCharacter>(GetOwner()) };
 
 	AAlsCharacter* AlsCharacter{ Cast<AAlsCharacter>(GetOwner()) };
@@ -43,6 +41,7 @@ public:
 
 	FALSXTImpactReactionParameters ImpactReactionParameters;
 
+	// Sweeps ahead of the moving character for obstacles it is about to bump into.
 	void ObstacleTrace();
 
 	/*Curve float reference*/
@@ -99,7 +98,9 @@ protected:
 	UFUNCTION(BlueprintNativeEvent, Category = "Parameters")
 	UAnimMontage* SelectAttackReactionMontage(FAttackDoubleHitResult Hit);
 
-	UFUNCTION(BlueprintNativeEvent, Category = "Parameters")
+	// Not used by impact reactions anymore, they pick their montage from the reaction table so that the pick can be replicated.
+	UFUNCTION(BlueprintNativeEvent, Category = "Parameters", Meta = (DeprecatedFunction,
+		DeprecationMessage = "Impact reaction montages are picked from the reaction table of the impact reaction settings."))
 	UAnimMontage* SelectImpactReactionMontage(FDoubleHitResult Hit);
 
 	UFUNCTION(BlueprintNativeEvent, Category = "Parameters")
@@ -193,6 +194,15 @@ protected:
 private:
 	FTimeline ImpactTimeline;
 
+	FRandomStream ReactionRandomStream;
+
+	// Recently played reactions, avoided by the next selections.
+	FALSXTReactionHistory ReactionHistory;
+
+	FTimerHandle BumpProbeTimerHandle;
+
+	double LastBumpTime{0.0};
+
 	FTimerHandle TimeSinceLastRecoveryTimerHandle;
 	float TimeSinceLastRecovery;
 
@@ -204,6 +214,16 @@ private:
 
 	bool IsImpactReactionAllowedToStart(const UAnimMontage* Montage) const;
 
+	UFUNCTION()
+	void OnCapsuleHit(UPrimitiveComponent* HitComponent, AActor* OtherActor, UPrimitiveComponent* OtherComponent,
+	                  FVector NormalImpulse, const FHitResult& Hit);
+
+	bool IsBumpObject(const UPrimitiveComponent* Component) const;
+
+	bool CanDetectBumps() const;
+
+	void TryStartBump(const FHitResult& Hit);
+
 	void StartBumpReaction(const FGameplayTag& Gait, const FGameplayTag& Side, const FGameplayTag& Form);
 
 	void StartAttackReaction(FAttackDoubleHitResult Hit);
@@ -219,33 +239,40 @@ private:
 	void StartResponse(FAttackDoubleHitResult Hit);
 
 	UFUNCTION(Server, Reliable, WithValidation)
-	void ServerAttackReaction(FAttackDoubleHitResult Hit);
+	void ServerAttackReaction(const FAttackDoubleHitResult& Hit);
 
 	UFUNCTION(NetMulticast, Reliable)
-	void MulticastAttackReaction(FAttackDoubleHitResult Hit);
+	void MulticastAttackReaction(const FAttackDoubleHitResult& Hit);
 
 	UFUNCTION(Server, Reliable)
-	void ServerImpactReaction(FDoubleHitResult Hit);
+	void ServerImpactReaction(const FDoubleHitResult& Hit);
 
 	UFUNCTION(NetMulticast, Reliable)
-	void MulticastImpactReaction(FDoubleHitResult Hit);
+	void MulticastImpactReaction(const FDoubleHitResult& Hit);
 
+	// Impact reactions are sent as an index into the reaction table of the impact reaction settings of the hit location,
+	// and the index of the montage picked among the montages of the reaction, where MAX_uint16 is the fallback montage.
+	// The particle actor and sound are resolved from the hit.
 	UFUNCTION(Server, Reliable)
-	void ServerStartImpactReaction(FDoubleHitResult Hit, UAnimMontage* Montage, TSubclassOf<AActor> ParticleActor, UNiagaraSystem* Particle, USoundBase* Audio);
+	void ServerStartImpactReaction(const FDoubleHitResult& Hit, uint16 ReactionIndex, uint16 MontageIndex, bool bBlocking);
 
 	UFUNCTION(NetMulticast, Reliable)
-	void MulticastStartImpactReaction(FDoubleHitResult Hit, UAnimMontage* Montage, TSubclassOf<AActor> ParticleActor, UNiagaraSystem* Particle, USoundBase* Audio);
+	void MulticastStartImpactReaction(const FDoubleHitResult& Hit, uint16 ReactionIndex, uint16 MontageIndex, bool bBlocking, bool bPredicted);
+
+	UAnimMontage* ResolveImpactReactionMontage(const FDoubleHitResult& Hit, int32 ReactionIndex, int32 MontageIndex, bool bBlocking);
 
-	void StartImpactReactionImplementation(FDoubleHitResult Hit, UAnimMontage* Montage, TSubclassOf<AActor> ParticleActor, UNiagaraSystem* Particle, USoundBase* Audio);
+	void StartImpactReactionImplementation(FDoubleHitResult Hit, UAnimMontage* Montage);
 
 	UFUNCTION(Server, Reliable, WithValidation)
-	void ServerSpawnParticleActor(FDoubleHitResult Hit, TSubclassOf<AActor> ParticleActor);
+	void ServerSpawnParticleActor(const FDoubleHitResult& Hit, TSubclassOf<AActor> ParticleActor);
 
 	UFUNCTION(NetMulticast, Reliable)
-	void MulticastSpawnParticleActor(FDoubleHitResult Hit, TSubclassOf<AActor> ParticleActor);
+	void MulticastSpawnParticleActor(const FDoubleHitResult& Hit, TSubclassOf<AActor> ParticleActor);
 
 	void SpawnParticleActorImplementation(FDoubleHitResult Hit, TSubclassOf<AActor> ParticleActor);
 
+	FQuat CalculateImpactSurfaceRotation(const FDoubleHitResult& Hit) const;
+
 	void RefreshImpactReaction(float DeltaTime);
 
 	void RefreshImpactReactionPhysics(float DeltaTime);
@@ -0,0 +1,27 @@
+// MIT
+
+#pragma once
+
+#include "ALSXTPooledEffectInterface.generated.h"
+
+UINTERFACE(Blueprintable)
+class UALSXTPooledEffectInterface : public UInterface {
+	GENERATED_BODY()
+};
+
+// Pooled impact effect actors only run BeginPlay once, when the pool spawns them. Effects that start their FX, spawn
+// components or set a life span in BeginPlay must do so in OnAcquiredFromPool instead, and undo it in OnReturnedToPool.
+class ALSXT_API IALSXTPooledEffectInterface {
+	GENERATED_BODY()
+
+public:
+
+	// Called every time the actor is moved into place and shown, after its particle systems were restarted.
+	UFUNCTION(BlueprintImplementableEvent, BlueprintCallable, Category = "Pooled Effect Interface")
+	void OnAcquiredFromPool();
+
+	// Called when the actor is hidden again, either because it finished or because it gets recycled.
+	UFUNCTION(BlueprintImplementableEvent, BlueprintCallable, Category = "Pooled Effect Interface")
+	void OnReturnedToPool();
+
+};
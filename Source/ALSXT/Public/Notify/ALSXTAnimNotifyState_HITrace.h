@@ -33,6 +33,9 @@ public:
 	virtual void NotifyBegin(USkeletalMeshComponent* Mesh, UAnimSequenceBase* Animation,
 	                         float Duration, const FAnimNotifyEventReference& EventReference) override;
 
+	virtual void NotifyTick(USkeletalMeshComponent* Mesh, UAnimSequenceBase* Animation,
+	                        float FrameDeltaTime, const FAnimNotifyEventReference& EventReference) override;
+
 	virtual void NotifyEnd(USkeletalMeshComponent* Mesh, UAnimSequenceBase* Animation,
 	                       const FAnimNotifyEventReference& EventReference) override;
 	
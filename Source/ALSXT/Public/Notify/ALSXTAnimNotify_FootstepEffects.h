@@ -5,12 +5,16 @@
 #include "Engine/DataAsset.h"
 #include "Engine/EngineTypes.h"
 #include "State/ALSXTFootstepState.h"
+#include "Utility/ALSXTEffectsPreloader.h"
+#include "Utility/ALSXTSurfaceEffectTable.h"
 #include "ALSXTAnimNotify_FootstepEffects.generated.h"
 
 class USoundBase;
 class UMaterialInterface;
 class UNiagaraSystem;
 
+enum class EALSXTEffectsSignificance : uint8;
+
 UENUM(BlueprintType)
 enum class EALSXTFootstepSoundType : uint8
 {
@@ -168,6 +172,9 @@ struct ALSXT_API FALSXTFootstepEffectSettings
 
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Particle System")
 	FRotator ParticleSystemFootRightRotationOffset{ForceInit};
+
+	// Copies the surface transfer values into a footprint state phase. Does not change the phase surface type.
+	void ApplyToFootprintPhase(FALSXTFootprintStatePhase& Phase) const;
 };
 
 UCLASS(Blueprintable, BlueprintType)
@@ -182,6 +189,10 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadOnly, Meta = (ClampMin = 0, ForceUnits = "cm"))
 	float SurfaceTraceDistance{50.0f};
 
+	// A foot that moved less than this since its last surface trace reuses that trace result.
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Meta = (ClampMin = 0, ForceUnits = "cm"))
+	float SurfaceTraceReuseDistance{2.0f};
+
 	UPROPERTY(EditAnywhere, BlueprintReadOnly, DisplayName = "Foot Left Y Axis")
 	FVector FootLeftYAxis{0.0f, 0.0f, 1.0f};
 
@@ -196,6 +207,40 @@ public:
 
 	UPROPERTY(EditAnywhere, BlueprintReadOnly, Meta = (ForceInlineRow))
 	TMap<TEnumAsByte<EPhysicalSurface>, FALSXTFootstepEffectSettings> Effects;
+
+private:
+	mutable TALSXTSurfaceEffectTable<FALSXTFootstepEffectSettings> EffectTable;
+
+	FALSXTEffectsPreloader Preloader;
+
+public:
+	virtual void PostLoad() override;
+
+	virtual void BeginDestroy() override;
+
+#if WITH_EDITOR
+	virtual void PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent) override;
+#endif
+
+	// Must be called after Effects is changed at runtime.
+	void CompileEffects();
+
+	const FALSXTFootstepEffectSettings* FindEffectSettings(EPhysicalSurface SurfaceType) const;
+
+	// Starts loading every soft referenced effect asset in the background. Effects of surfaces
+	// whose assets are not loaded yet are skipped instead of being loaded synchronously.
+	UFUNCTION(BlueprintCallable, Category = "ALSXT|Preload")
+	void RequestPreload();
+
+	UFUNCTION(BlueprintPure, Category = "ALSXT|Preload")
+	FALSXTEffectsPreloadInfo GetPreloadInfo() const;
+
+	bool IsPreloadRequested() const;
+
+	// Restores a replicated footprint state. Phases whose surface type changed are refilled from the effects of the new surface.
+	void RebuildFootprintState(const FALSXTFootprintNetState& NetState, FALSXTFootprintState& State) const;
+
+	void RebuildFootprintsState(const FALSXTFootprintsNetState& NetState, FALSXTFootprintsState& State) const;
 };
 
 UCLASS(DisplayName = "ALSXT Footstep Effects Animation Notify",
@@ -252,4 +297,19 @@ public:
 
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Settings|Particle System", Meta = (AllowPrivateAccess))
 	FALSXTFootprintsState CurrentFootprintsState;
+
+private:
+	// Gameplay relevant, so it is neither gated by the effects significance nor deferred by the effects scheduler.
+	void UpdateFootprintsState(USkeletalMeshComponent* Mesh, const FHitResult& Hit) const;
+
+	void ScheduleEffects(USkeletalMeshComponent* Mesh, const FTransform& FootTransform, const FHitResult& Hit,
+	                     EALSXTEffectsSignificance Significance);
+
+	void SpawnEffects(USkeletalMeshComponent* Mesh, const FTransform& FootTransform, const FHitResult& Hit,
+	                  EALSXTEffectsSignificance Significance);
 };
+
+inline bool UALSXTFootstepEffectsSettings::IsPreloadRequested() const
+{
+	return Preloader.IsRequested();
+}
@@ -7,12 +7,16 @@
 #include "Engine/DataAsset.h"
 #include "Engine/EngineTypes.h"
 #include "State/ALSXTFootstepState.h"
+#include "Utility/ALSXTEffectsPreloader.h"
+#include "Utility/ALSXTSurfaceEffectTable.h"
 #include "ALSXTAnimNotify_SlideEffects.generated.h"
 
 class USoundBase;
 class UMaterialInterface;
 class UNiagaraSystem;
 
+enum class EALSXTEffectsSignificance : uint8;
+
 USTRUCT(BlueprintType)
 struct ALSXT_API FALSXTSlideEffectSettings
 {
@@ -136,6 +140,10 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadOnly, Meta = (ClampMin = 0, ForceUnits = "cm"))
 	float SurfaceTraceDistance{50.0f};
 
+	// A foot that moved less than this since its last surface trace reuses that trace result.
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Meta = (ClampMin = 0, ForceUnits = "cm"))
+	float SurfaceTraceReuseDistance{2.0f};
+
 	UPROPERTY(EditAnywhere, BlueprintReadOnly, DisplayName = "Foot Left Y Axis")
 	FVector FootLeftYAxis {0.0f, 0.0f, 1.0f};
 
@@ -150,6 +158,35 @@ public:
 
 	UPROPERTY(EditAnywhere, BlueprintReadOnly, Meta = (ForceInlineRow))
 	TMap<TEnumAsByte<EPhysicalSurface>, FALSXTSlideEffectSettings> Effects;
+
+private:
+	mutable TALSXTSurfaceEffectTable<FALSXTSlideEffectSettings> EffectTable;
+
+	FALSXTEffectsPreloader Preloader;
+
+public:
+	virtual void PostLoad() override;
+
+	virtual void BeginDestroy() override;
+
+#if WITH_EDITOR
+	virtual void PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent) override;
+#endif
+
+	// Must be called after Effects is changed at runtime.
+	void CompileEffects();
+
+	const FALSXTSlideEffectSettings* FindEffectSettings(EPhysicalSurface SurfaceType) const;
+
+	// Starts loading every soft referenced effect asset in the background. Effects of surfaces
+	// whose assets are not loaded yet are skipped instead of being loaded synchronously.
+	UFUNCTION(BlueprintCallable, Category = "ALSXT|Preload")
+	void RequestPreload();
+
+	UFUNCTION(BlueprintPure, Category = "ALSXT|Preload")
+	FALSXTEffectsPreloadInfo GetPreloadInfo() const;
+
+	bool IsPreloadRequested() const;
 };
 
 /**
@@ -193,5 +230,16 @@ public:
 
 	UPROPERTY(EditAnywhere, BlueprintReadOnly, Meta = (AllowPrivateAccess))
 	FHitResult HitResult;
-	
+
+private:
+	void ScheduleEffects(USkeletalMeshComponent* Mesh, const FTransform& FootTransform, const FHitResult& Hit,
+	                     EALSXTEffectsSignificance Significance);
+
+	void SpawnEffects(USkeletalMeshComponent* Mesh, const FTransform& FootTransform, const FHitResult& Hit,
+	                  EALSXTEffectsSignificance Significance);
 };
+
+inline bool UALSXTSlideEffectsSettings::IsPreloadRequested() const
+{
+	return Preloader.IsRequested();
+}
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "Utility/ALSXTStructs.h"
+#include "Utility/ALSXTReactionMontageTable.h"
 #include "Engine/DataAsset.h"
 #include "Engine/EngineTypes.h"
 #include "ALSXTAttackReactionSettings.generated.h"
@@ -56,7 +57,22 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Settings", Meta = (ClampMin = 0))
 	FVector2D PlayRate{1.0f, 1.0f};
 
+private:
+	mutable FALSXTReactionMontageTable ReactionTable;
+
 public:
+	virtual void PostLoad() override;
+
+#if WITH_EDITOR
+	virtual void PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent) override;
+#endif
+
+	// Must be called after ImpactReactionLocations is changed at runtime.
+	UFUNCTION(BlueprintCallable, Category = "ALS|Attack Reaction Settings")
+	void CompileReactions() const;
+
+	const FALSXTReactionMontageTable& GetReactionTable() const;
+
 	float CalculateStartTime(float AttackHeight) const;
 
 	float CalculatePlayRate(float AttackHeight) const;
@@ -12,6 +12,9 @@
 #include "Settings/ALSXTCombatSettings.h"
 #include "ALSXTCharacterSettings.generated.h"
 
+class UALSXTFootstepEffectsSettings;
+class UALSXTSlideEffectsSettings;
+
 UENUM(BlueprintType)
 enum class ESide : uint8
 {
@@ -49,6 +52,14 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadOnly)
 	FALSXTGeneralImpactReactionSettings ImpactReaction;
 
+	// Used to rebuild replicated footprint states, should match the settings of the footstep notifies.
+	UPROPERTY(EditAnywhere, BlueprintReadOnly)
+	TObjectPtr<UALSXTFootstepEffectsSettings> FootstepEffects;
+
+	// Preloaded on begin play together with the footstep effects.
+	UPROPERTY(EditAnywhere, BlueprintReadOnly)
+	TObjectPtr<UALSXTSlideEffectsSettings> SlideEffects;
+
 	UALSXTCharacterSettings();
 	
 };
@@ -1,10 +1,13 @@
 #pragma once
 
 #include "Utility/ALSXTStructs.h"
+#include "Utility/ALSXTSoundTagTable.h"
 #include "Engine/DataAsset.h"
 #include "Engine/EngineTypes.h"
 #include "ALSXTCharacterSoundSettings.generated.h"
 
+class UALSXTCharacterSoundSettings;
+
 USTRUCT(BlueprintType)
 struct ALSXT_API FALSXTCharacterSoundParameters
 {
@@ -14,6 +17,37 @@ struct ALSXT_API FALSXTCharacterSoundParameters
 	FGameplayTag Location{FGameplayTag::EmptyTag};
 };
 
+UENUM()
+enum class EALSXTCharacterSoundType : uint8
+{
+	Action,
+	Attack,
+	Damage,
+	Death
+};
+
+// A played character sound identified by its index in the settings, so only a few bytes are replicated.
+USTRUCT()
+struct ALSXT_API FALSXTCharacterSoundEvent
+{
+	GENERATED_BODY()
+
+	// The settings the sound was selected from. Replicated as a reference, so receivers don't depend
+	// on selecting the same settings themselves.
+	UPROPERTY()
+	TObjectPtr<UALSXTCharacterSoundSettings> Settings;
+
+	UPROPERTY()
+	EALSXTCharacterSoundType Type{EALSXTCharacterSoundType::Action};
+
+	UPROPERTY()
+	uint16 SoundIndex{0};
+
+	// Increases with every event of a character, so reordered events can be dropped.
+	UPROPERTY()
+	uint8 Sequence{0};
+};
+
 UCLASS(Blueprintable, BlueprintType)
 class ALSXT_API UALSXTCharacterSoundSettings : public UDataAsset
 {
@@ -31,6 +65,40 @@ public:
 
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Meta = (TitleProperty = "{Form} {Damage} {Sound}", AllowPrivateAccess))
 	TArray<FALSXTCharacterDamageSound> DeathSounds;
+
+private:
+	mutable FALSXTSoundTagTable ActionSoundTable;
+
+	mutable FALSXTSoundTagTable AttackSoundTable;
+
+	mutable FALSXTSoundTagTable DamageSoundTable;
+
+	mutable FALSXTSoundTagTable DeathSoundTable;
+
+public:
+	virtual void PostLoad() override;
+
+#if WITH_EDITOR
+	virtual void PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent) override;
+#endif
+
+	// Must be called after the sound arrays are changed at runtime.
+	void CompileSounds() const;
+
+	// Strength and stamina.
+	const FALSXTSoundTagTable& GetActionSoundTable() const;
+
+	// Strength and stamina.
+	const FALSXTSoundTagTable& GetAttackSoundTable() const;
+
+	// Form and damage.
+	const FALSXTSoundTagTable& GetDamageSoundTable() const;
+
+	// Form and damage.
+	const FALSXTSoundTagTable& GetDeathSoundTable() const;
+
+	// Returns nullptr if the index is out of range.
+	const FALSXTCharacterSound* FindSound(EALSXTCharacterSoundType Type, int32 SoundIndex) const;
 };
 
 USTRUCT(BlueprintType)
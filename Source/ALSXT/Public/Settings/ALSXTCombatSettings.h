@@ -26,6 +26,33 @@ struct ALSXT_API FALSXTCombatParameters
 	FGameplayTag Location{FGameplayTag::EmptyTag};
 };
 
+struct ALSXT_API FALSXTAttackMontageKey
+{
+	FGameplayTag AttackType;
+
+	FGameplayTag Strength;
+
+	FGameplayTag Stance;
+
+	bool operator==(const FALSXTAttackMontageKey& Other) const
+	{
+		return AttackType == Other.AttackType && Strength == Other.Strength && Stance == Other.Stance;
+	}
+
+	friend uint32 GetTypeHash(const FALSXTAttackMontageKey& Key)
+	{
+		return HashCombine(HashCombine(GetTypeHash(Key.AttackType), GetTypeHash(Key.Strength)), GetTypeHash(Key.Stance));
+	}
+};
+
+// Range of an attack's montages in the flat montage array of the index.
+struct ALSXT_API FALSXTAttackMontageSpan
+{
+	int32 FirstIndex{0};
+
+	int32 Num{0};
+};
+
 UCLASS(Blueprintable, BlueprintType)
 class ALSXT_API UALSXTCombatSettings : public UDataAsset
 {
@@ -61,12 +88,46 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Settings", Meta = (ClampMin = 0))
 	FVector2D PlayRate{1.0f, 1.0f};
 
+private:
+	// Copies of the montages of all attack type, strength and stance combinations, with the montages of each
+	// combination next to each other. Copied rather than pointing into AttackTypes, so changing AttackTypes
+	// without compiling again leaves the table outdated, but never dangling.
+	UPROPERTY(Transient)
+	mutable TArray<FActionMontageInfo> AttackMontages;
+
+	mutable TMap<FALSXTAttackMontageKey, FALSXTAttackMontageSpan> AttackMontageSpans;
+
+	mutable bool bAttackMontagesCompiled{false};
+
 public:
+	virtual void PostLoad() override;
+
+#if WITH_EDITOR
+	virtual void PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent) override;
+#endif
+
+	// Must be called after AttackTypes is changed at runtime.
+	UFUNCTION(BlueprintCallable, Category = "ALS|Combat Settings")
+	void CompileAttackMontages() const;
+
+	// Picks a random montage of the attack and returns its index, or INDEX_NONE if the attack has no montages.
+	// The montage at PreviousMontageIndex is never picked again, unless it is the only one of the attack.
+	int32 SelectAttackMontageIndex(const FGameplayTag& AttackType, const FGameplayTag& Strength,
+	                               const FGameplayTag& Stance, int32 PreviousMontageIndex = INDEX_NONE) const;
+
+	// Returns nullptr if the index is not a montage of the compiled table.
+	const FActionMontageInfo* GetAttackMontage(int32 MontageIndex) const;
+
 	float CalculateStartTime(float UnarmedAttackHeight) const;
 
 	float CalculatePlayRate(float UnarmedAttackHeight) const;
 };
 
+inline const FActionMontageInfo* UALSXTCombatSettings::GetAttackMontage(const int32 MontageIndex) const
+{
+	return AttackMontages.IsValidIndex(MontageIndex) ? &AttackMontages[MontageIndex] : nullptr;
+}
+
 inline float UALSXTCombatSettings::CalculateStartTime(const float UnarmedAttackHeight) const
 {
 	return FMath::GetMappedRangeValueClamped(ReferenceHeight, StartTime, UnarmedAttackHeight);
@@ -122,8 +183,11 @@ struct ALSXT_API FALSXTGeneralCombatSettings
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Settings", Meta = (AllowPrivateAccess))
 	FLinearColor HighlightColor { 1.0f, 0.0f, 1.0f, 1.0 };
 
-	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Settings", Meta = (AllowPrivateAccess))
-	FName HighlightMaterialParameterName { "Highlight" };
+	// Custom primitive data index written to highlight a target. The highlight parameter of the character materials
+	// must use custom primitive data with this index, so no dynamic material instances are needed. Defaults to the
+	// last of the 36 available slots, away from the low indices materials usually take first.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Settings", Meta = (ClampMin = 0, ClampMax = 35, AllowPrivateAccess))
+	int32 HighlightCustomPrimitiveDataIndex { 35 };
 
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Settings", Meta = (AllowPrivateAccess))
 	FVector	TraceAreaHalfSize { 400.0f, 400.0f, 150.0f };
@@ -140,9 +204,54 @@ struct ALSXT_API FALSXTGeneralCombatSettings
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Settings", Meta = (AllowPrivateAccess))
 	TArray<TEnumAsByte<EObjectTypeQuery>> ObstructionTraceObjectTypes;
 
+	// How often a locked-on target is checked for distance and obstruction.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Settings", Meta = (ClampMin = 0.01, ForceUnits = "s", AllowPrivateAccess))
+	float TargetTrackingInterval { 0.1f };
+
+	// Obstruction is only traced again once the player or the target moved farther than this since the last trace.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Settings", Meta = (ClampMin = 0, ForceUnits = "cm", AllowPrivateAccess))
+	float TargetObstructionRecheckDistance { 25.0f };
+
+	// Zero turns the player to the target instantly.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Settings", Meta = (ClampMin = 0, AllowPrivateAccess))
+	float TargetRotationInterpolationSpeed { 15.0f };
+
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS")
 	TArray<TEnumAsByte<EObjectTypeQuery>> AttackTraceObjectTypes;
 
+	// A limb that rotated more than this since the previous trace sample is swept in several steps.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS", Meta = (ClampMin = 1, ClampMax = 180, ForceUnits = "deg"))
+	float AttackTraceMaxSubstepAngle{ 15.0f };
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "ALS", Meta = (ClampMin = 1))
+	int32 AttackTraceMaxSubsteps{ 4 };
+
+	// Remotely controlled characters send their attack hits to the server, which checks them against
+	// the victim's recorded pose at the attack time instead of tracing the attack again.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Lag Compensation")
+	bool bValidateAttackHitsOnServer{ true };
+
+	// Samples are recorded every server tick, 32 samples cover about half a second at 60 Hz.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Lag Compensation", Meta = (ClampMin = 2))
+	int32 RewindBufferCapacity{ 32 };
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Lag Compensation", Meta = (ClampMin = 0, ForceUnits = "s"))
+	float MaxRewindTime{ 0.3f };
+
+	// At most 8 bones are recorded.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Lag Compensation")
+	TArray<FName> RewindBoneNames{ TEXT("head"), TEXT("pelvis"), TEXT("hand_l"), TEXT("hand_r"), TEXT("foot_l"), TEXT("foot_r") };
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Lag Compensation", Meta = (ClampMin = 0, ForceUnits = "cm"))
+	float AttackHitValidationTolerance{ 25.0f };
+
+	// How far a recorded bone of the victim may be from the attack path when the hit claims that bone.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Lag Compensation", Meta = (ClampMin = 0, ForceUnits = "cm"))
+	float AttackHitBoneValidationTolerance{ 40.0f };
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Lag Compensation", Meta = (ClampMin = 0, ForceUnits = "cm"))
+	float MaxAttackReach{ 250.0f };
+
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Settings", Meta = (AllowPrivateAccess))
 	bool DebugMode {false};
 
@@ -1,10 +1,21 @@
 #pragma once
 
 #include "Utility/ALSXTStructs.h"
+#include "Utility/ALSXTReactionMontageTable.h"
 #include "Engine/DataAsset.h"
 #include "Engine/EngineTypes.h"
 #include "ALSXTImpactReactionSettings.generated.h"
 
+UENUM(BlueprintType)
+enum class EALSXTBumpDetectionMode : uint8
+{
+	Disabled,
+	// Bumps are taken from the blocking hits of the character movement sweeps.
+	MovementHits,
+	// Movement hits, and a sweep ahead of the character at the bump probe interval.
+	MovementHitsAndProbe
+};
+
 USTRUCT(BlueprintType)
 struct ALSXT_API FALSXTImpactReactionParameters
 {
@@ -80,7 +91,22 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Settings", Meta = (ClampMin = 0))
 	FVector2D PlayRate{1.0f, 1.0f};
 
+private:
+	mutable FALSXTReactionMontageTable ReactionTable;
+
 public:
+	virtual void PostLoad() override;
+
+#if WITH_EDITOR
+	virtual void PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent) override;
+#endif
+
+	// Must be called after ImpactReactionLocations is changed at runtime.
+	UFUNCTION(BlueprintCallable, Category = "ALS|Impact Reaction Settings")
+	void CompileReactions() const;
+
+	const FALSXTReactionMontageTable& GetReactionTable() const;
+
 	float CalculateStartTime(float ImpactHeight, float RefHeight, float Start) const;
 
 	float CalculatePlayRate(float ImpactHeight, float RefHeight, float Rate) const;
@@ -104,6 +130,21 @@ struct ALSXT_API FALSXTGeneralImpactReactionSettings
 	UPROPERTY(EditAnywhere, BlueprintReadWrite)
 	bool bAllowImpactReaction{ true };
 
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Meta = (AllowPrivateAccess))
+	EALSXTBumpDetectionMode BumpDetectionMode{EALSXTBumpDetectionMode::MovementHits};
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Meta = (AllowPrivateAccess, ClampMin = 0.01, ForceUnits = "s"))
+	float BumpProbeInterval{0.25f};
+
+	// Bumps within this time after the previous bump are ignored, whatever was hit.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Meta = (AllowPrivateAccess, ClampMin = 0, ForceUnits = "s"))
+	float BumpCooldown{0.5f};
+
+	// Speed towards the hit surface below which a movement hit is not a bump.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Meta = (AllowPrivateAccess, ClampMin = 0, ForceUnits = "cm/s"))
+	float MinBumpSpeed{50.0f};
+
+	// Distances ahead of the character swept by the bump probe.
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Meta = (AllowPrivateAccess))
 	float WalkingBumpDetectionDistance {10.0f};
 
@@ -2,6 +2,16 @@
 
 #include "ALSXTCombatState.generated.h"
 
+UENUM(BlueprintType)
+enum class EALSXTAttackPhase : uint8
+{
+	None,
+	// The attack montage is playing.
+	Attacking,
+	// The attack montage is blending out.
+	Recovering
+};
+
 USTRUCT(BlueprintType)
 struct ALSXT_API FALSXTCombatState
 {
@@ -9,5 +19,7 @@ struct ALSXT_API FALSXTCombatState
 
 		UPROPERTY(EditAnywhere, BlueprintReadWrite, Meta = (ClampMin = -180, ClampMax = 180, ForceUnits = "deg"))
 		float TargetYawAngle{ 0.0f };
-};
 
+		UPROPERTY(VisibleAnywhere, BlueprintReadOnly)
+		EALSXTAttackPhase AttackPhase{ EALSXTAttackPhase::None };
+};
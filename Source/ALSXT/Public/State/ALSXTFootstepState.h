@@ -124,6 +124,54 @@ struct ALSXT_API FALSXTFootprintsState
 
 };
 
+// Replicated form of FALSXTFootprintState. Everything else is rebuilt from the footstep effects settings of the surface types.
+USTRUCT(BlueprintType)
+struct ALSXT_API FALSXTFootprintNetState
+{
+	GENERATED_BODY()
+
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly)
+	TEnumAsByte<EPhysicalSurface> CurrentSurfaceType {0};
+
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly)
+	TEnumAsByte<EPhysicalSurface> PreviousSurfaceType {0};
+
+	// FootSurfaceAlpha in 1/255 steps.
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly)
+	uint8 FootSurfaceAlpha{0};
+
+	// Current phase TransferAmount clamped to 0-1, in 1/255 steps.
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly)
+	uint8 Saturation{0};
+
+	static FALSXTFootprintNetState FromFootprintState(const FALSXTFootprintState& State);
+
+	// Only writes the replicated values, see UALSXTFootstepEffectsSettings::RebuildFootprintState() for the rest.
+	void ApplyTo(FALSXTFootprintState& State) const;
+
+	bool operator==(const FALSXTFootprintNetState& Other) const;
+
+	bool operator!=(const FALSXTFootprintNetState& Other) const;
+};
+
+USTRUCT(BlueprintType)
+struct ALSXT_API FALSXTFootprintsNetState
+{
+	GENERATED_BODY()
+
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly)
+	FALSXTFootprintNetState Left;
+
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly)
+	FALSXTFootprintNetState Right;
+
+	static FALSXTFootprintsNetState FromFootprintsState(const FALSXTFootprintsState& State);
+
+	bool operator==(const FALSXTFootprintsNetState& Other) const;
+
+	bool operator!=(const FALSXTFootprintsNetState& Other) const;
+};
+
 USTRUCT(BlueprintType)
 struct ALSXT_API FALSXTFootwearDetails
 {
@@ -144,4 +192,53 @@ struct ALSXT_API FALSXTFootwearDetails
 	UPROPERTY(EditAnywhere, BlueprintReadWrite)
 	TEnumAsByte<EPhysicalSurface> FootwearSoleSurfaceType {0};
 
-};
\ No newline at end of file
+};
+
+inline FALSXTFootprintNetState FALSXTFootprintNetState::FromFootprintState(const FALSXTFootprintState& State)
+{
+	FALSXTFootprintNetState NetState;
+	NetState.CurrentSurfaceType = State.Current.SurfaceType;
+	NetState.PreviousSurfaceType = State.Previous.SurfaceType;
+	NetState.FootSurfaceAlpha = FMath::Quantize8UnsignedByte(UAlsMath::Clamp01(State.FootSurfaceAlpha));
+	NetState.Saturation = FMath::Quantize8UnsignedByte(UAlsMath::Clamp01(State.Current.TransferAmount));
+
+	return NetState;
+}
+
+inline void FALSXTFootprintNetState::ApplyTo(FALSXTFootprintState& State) const
+{
+	State.Current.SurfaceType = CurrentSurfaceType;
+	State.Previous.SurfaceType = PreviousSurfaceType;
+	State.FootSurfaceAlpha = FootSurfaceAlpha / 255.0f;
+	State.Current.TransferAmount = Saturation / 255.0f;
+}
+
+inline bool FALSXTFootprintNetState::operator==(const FALSXTFootprintNetState& Other) const
+{
+	return CurrentSurfaceType == Other.CurrentSurfaceType && PreviousSurfaceType == Other.PreviousSurfaceType &&
+	       FootSurfaceAlpha == Other.FootSurfaceAlpha && Saturation == Other.Saturation;
+}
+
+inline bool FALSXTFootprintNetState::operator!=(const FALSXTFootprintNetState& Other) const
+{
+	return !(*this == Other);
+}
+
+inline FALSXTFootprintsNetState FALSXTFootprintsNetState::FromFootprintsState(const FALSXTFootprintsState& State)
+{
+	FALSXTFootprintsNetState NetState;
+	NetState.Left = FALSXTFootprintNetState::FromFootprintState(State.Left);
+	NetState.Right = FALSXTFootprintNetState::FromFootprintState(State.Right);
+
+	return NetState;
+}
+
+inline bool FALSXTFootprintsNetState::operator==(const FALSXTFootprintsNetState& Other) const
+{
+	return Left == Other.Left && Right == Other.Right;
+}
+
+inline bool FALSXTFootprintsNetState::operator!=(const FALSXTFootprintsNetState& Other) const
+{
+	return !(*this == Other);
+}
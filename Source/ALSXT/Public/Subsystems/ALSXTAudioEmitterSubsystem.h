@@ -0,0 +1,150 @@
+// MIT
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "ALSXTAudioEmitterSubsystem.generated.h"
+
+class UAudioComponent;
+class USceneComponent;
+class USoundBase;
+class USoundConcurrency;
+
+UENUM(BlueprintType)
+enum class EALSXTAudioEmitterCategory : uint8
+{
+	Footstep,
+	Vocal,
+	Impact
+};
+
+UENUM(BlueprintType)
+enum class EALSXTAudioVoiceStealingPolicy : uint8
+{
+	// Stop the voice that started playing first.
+	StealOldest,
+	// Stop the voice that was started with the lowest volume multiplier.
+	StealQuietest,
+	// Drop the new sound while the budget is used up.
+	DiscardNewest
+};
+
+USTRUCT(BlueprintType)
+struct ALSXT_API FALSXTAudioEmitterCategorySettings
+{
+	GENERATED_BODY()
+
+	// Maximum number of sounds of this category that play at the same time.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Settings", Meta = (ClampMin = 1))
+	int32 VoiceBudget{16};
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Settings")
+	EALSXTAudioVoiceStealingPolicy StealingPolicy{EALSXTAudioVoiceStealingPolicy::StealOldest};
+
+	// Applied to every sound of this category, in addition to the concurrency settings of the sound itself.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Settings")
+	TSoftObjectPtr<USoundConcurrency> Concurrency;
+};
+
+USTRUCT(BlueprintType)
+struct ALSXT_API FALSXTAudioEmitterPoolStats
+{
+	GENERATED_BODY()
+
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Stats")
+	int32 ActiveVoices{0};
+
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Stats")
+	int32 ComponentsCreated{0};
+
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Stats")
+	int32 TotalPlayed{0};
+
+	// Sounds that were stopped to make room for a new one.
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Stats")
+	int32 TotalStolen{0};
+
+	// Sounds dropped because their category was out of voices (DiscardNewest only).
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Stats")
+	int32 TotalDiscarded{0};
+};
+
+// Per-world pool of registered audio components used for footstep, vocal and impact sounds, so that
+// these sounds never create, register or garbage collect audio components at runtime. Each category
+// has its own voice budget, and a new sound steals a voice of its category once the budget is used up.
+UCLASS(Config = Game)
+class ALSXT_API UALSXTAudioEmitterSubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+private:
+	UPROPERTY(Config, EditAnywhere, Category = "Settings", Meta = (AllowPrivateAccess))
+	FALSXTAudioEmitterCategorySettings FootstepSettings{32};
+
+	UPROPERTY(Config, EditAnywhere, Category = "Settings", Meta = (AllowPrivateAccess))
+	FALSXTAudioEmitterCategorySettings VocalSettings{16};
+
+	UPROPERTY(Config, EditAnywhere, Category = "Settings", Meta = (AllowPrivateAccess))
+	FALSXTAudioEmitterCategorySettings ImpactSettings{16};
+
+	UPROPERTY(Transient)
+	TArray<TObjectPtr<UAudioComponent>> Emitters;
+
+	struct FEmitterSlot
+	{
+		EALSXTAudioEmitterCategory Category{EALSXTAudioEmitterCategory::Footstep};
+
+		double PlayTime{0.0};
+
+		float VolumeMultiplier{1.0f};
+	};
+
+	TArray<FEmitterSlot> Slots;
+
+	UPROPERTY(Transient)
+	TArray<TObjectPtr<USoundConcurrency>> CategoryConcurrencies;
+
+	FALSXTAudioEmitterPoolStats Stats;
+
+public:
+	virtual void OnWorldBeginPlay(UWorld& InWorld) override;
+
+	virtual void Deinitialize() override;
+
+protected:
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+public:
+	UFUNCTION(BlueprintCallable, Category = "ALSXT|Audio Emitter Pool")
+	void SetCategorySettings(EALSXTAudioEmitterCategory Category, const FALSXTAudioEmitterCategorySettings& NewSettings);
+
+	UFUNCTION(BlueprintPure, Category = "ALSXT|Audio Emitter Pool")
+	const FALSXTAudioEmitterCategorySettings& GetCategorySettings(EALSXTAudioEmitterCategory Category) const;
+
+	UFUNCTION(BlueprintPure, Category = "ALSXT|Audio Emitter Pool")
+	FALSXTAudioEmitterPoolStats GetStats() const;
+
+	// Plays the sound on a pooled audio component and returns it, or nullptr if the sound was dropped.
+	// The component must not be kept, it gets reused as soon as the sound has finished or is stolen.
+	UAudioComponent* PlaySoundAtLocation(EALSXTAudioEmitterCategory Category, USoundBase* Sound, const FVector& Location,
+	                                     const FRotator& Rotation, float VolumeMultiplier = 1.0f, float PitchMultiplier = 1.0f);
+
+	UAudioComponent* PlaySoundAttached(EALSXTAudioEmitterCategory Category, USoundBase* Sound, USceneComponent* AttachComponent,
+	                                   FName SocketName, float VolumeMultiplier = 1.0f, float PitchMultiplier = 1.0f);
+
+	UFUNCTION(BlueprintCallable, Category = "ALSXT|Audio Emitter Pool")
+	void StopAllSounds();
+
+private:
+	FALSXTAudioEmitterCategorySettings& GetMutableCategorySettings(EALSXTAudioEmitterCategory Category);
+
+	void LoadCategoryConcurrencies();
+
+	UAudioComponent* AcquireEmitter(EALSXTAudioEmitterCategory Category, USoundBase* Sound, float VolumeMultiplier,
+	                                float PitchMultiplier, USceneComponent* AttachComponent);
+
+	UAudioComponent* CreateEmitter();
+
+	void OnEmitterFinished(UAudioComponent* Emitter);
+};
@@ -0,0 +1,144 @@
+// MIT
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "UObject/ObjectKey.h"
+#include "State/ALSXTFootstepState.h"
+#include "ALSXTEffectsSchedulerSubsystem.generated.h"
+
+class USceneComponent;
+
+DECLARE_DELEGATE(FALSXTScheduledEffectDelegate);
+
+struct ALSXT_API FALSXTScheduledEffectRequest
+{
+	TWeakObjectPtr<USceneComponent> Mesh;
+
+	// Identifies the kind of effect, e.g. the notify class. A newer request with the same
+	// mesh, source and foot replaces the queued one instead of spawning twice.
+	const UObject* Source{nullptr};
+
+	EALSXTFootBone Foot{EALSXTFootBone::Left};
+
+	FVector Location{ForceInit};
+};
+
+USTRUCT(BlueprintType)
+struct ALSXT_API FALSXTEffectsSchedulerStats
+{
+	GENERATED_BODY()
+
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Stats")
+	int32 QueuedEffects{0};
+
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Stats")
+	int32 PeakQueuedEffects{0};
+
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Stats")
+	int32 LastFrameProcessedEffects{0};
+
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Stats", Meta = (ForceUnits = "ms"))
+	float LastFrameProcessingTime{0.0f};
+
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Stats", Meta = (ForceUnits = "ms"))
+	float PeakFrameProcessingTime{0.0f};
+
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Stats")
+	int32 TotalProcessed{0};
+
+	// Requests replaced by a newer request of the same character and foot.
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Stats")
+	int32 TotalDeduplicated{0};
+
+	// Requests that waited longer than the maximum queue time.
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Stats")
+	int32 TotalExpired{0};
+};
+
+// Collects the footstep and slide effects of all characters and spawns them in one pass per frame,
+// closest to the camera first, until the time budget is used up. The rest waits for the next frame.
+UCLASS(Config = Game)
+class ALSXT_API UALSXTEffectsSchedulerSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+private:
+	// The closest queued effect is always spawned, even if it alone exceeds the budget.
+	UPROPERTY(Config, EditAnywhere, Category = "Settings", Meta = (AllowPrivateAccess, ClampMin = 0, ForceUnits = "ms"))
+	float FrameBudget{0.5f};
+
+	// Effects that could not be spawned within this time are dropped, a late footstep is worse than none.
+	UPROPERTY(Config, EditAnywhere, Category = "Settings", Meta = (AllowPrivateAccess, ClampMin = 0, ForceUnits = "s"))
+	float MaxQueueTime{0.2f};
+
+	struct FQueuedEffect
+	{
+		FALSXTScheduledEffectRequest Request;
+
+		FALSXTScheduledEffectDelegate Callback;
+
+		double DistanceSquared{0.0};
+
+		double EnqueueTime{0.0};
+	};
+
+	struct FQueuedEffectKey
+	{
+		TObjectKey<USceneComponent> Mesh;
+
+		const UObject* Source{nullptr};
+
+		EALSXTFootBone Foot{EALSXTFootBone::Left};
+
+		bool operator==(const FQueuedEffectKey& Other) const
+		{
+			return Mesh == Other.Mesh && Source == Other.Source && Foot == Other.Foot;
+		}
+
+		friend uint32 GetTypeHash(const FQueuedEffectKey& Key)
+		{
+			return HashCombine(HashCombine(GetTypeHash(Key.Mesh), GetTypeHash(Key.Source)), static_cast<uint32>(Key.Foot));
+		}
+	};
+
+	TArray<FQueuedEffect> QueuedEffects;
+
+	TMap<FQueuedEffectKey, int32> QueuedEffectIndices;
+
+	FALSXTEffectsSchedulerStats Stats;
+
+public:
+	virtual void Deinitialize() override;
+
+	virtual void Tick(float DeltaTime) override;
+
+	virtual TStatId GetStatId() const override;
+
+	virtual bool IsTickable() const override;
+
+	UFUNCTION(BlueprintCallable, Category = "ALSXT|Effects Scheduler")
+	void SetFrameBudget(float NewFrameBudget);
+
+	UFUNCTION(BlueprintPure, Category = "ALSXT|Effects Scheduler")
+	float GetFrameBudget() const;
+
+	UFUNCTION(BlueprintPure, Category = "ALSXT|Effects Scheduler")
+	FALSXTEffectsSchedulerStats GetStats() const;
+
+	void EnqueueEffect(const FALSXTScheduledEffectRequest& Request, FALSXTScheduledEffectDelegate&& Callback);
+
+	// Queues the effect, or spawns it right away in worlds without this subsystem, such as animation editor previews.
+	// The callback may be delayed, replaced by a newer request or dropped, so it must only spawn cosmetic effects.
+	// Gameplay state such as the footprints state has to be updated before the effect is scheduled.
+	static void ScheduleEffect(UWorld* World, const FALSXTScheduledEffectRequest& Request, FALSXTScheduledEffectDelegate&& Callback);
+
+private:
+	void ProcessQueue();
+};
+
+inline float UALSXTEffectsSchedulerSubsystem::GetFrameBudget() const
+{
+	return FrameBudget;
+}
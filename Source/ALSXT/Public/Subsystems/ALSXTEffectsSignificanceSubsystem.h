@@ -0,0 +1,125 @@
+// MIT
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "ALSXTEffectsSignificanceSubsystem.generated.h"
+
+class UPrimitiveComponent;
+
+// Ordered from the most to the least effects, each value allows a subset of the previous one.
+UENUM(BlueprintType)
+enum class EALSXTEffectsSignificance : uint8
+{
+	Full,
+	SoundAndDecal,
+	SoundOnly,
+	None
+};
+
+USTRUCT(BlueprintType)
+struct ALSXT_API FALSXTEffectsSignificanceTier
+{
+	GENERATED_BODY()
+
+	// Characters farther than this from the closest local viewer fall through to the next tier.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Settings", Meta = (ClampMin = 0, ForceUnits = "cm"))
+	float MaxDistance{1500.0f};
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Settings")
+	EALSXTEffectsSignificance Significance{EALSXTEffectsSignificance::Full};
+};
+
+// Decides how much of the footstep and slide effects of a character is worth spawning, based on the
+// distance to the local viewers, whether the character is rendered and a per-frame effect budget.
+// Dedicated servers never spawn cosmetic effects.
+UCLASS(Config = Game)
+class ALSXT_API UALSXTEffectsSignificanceSubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+private:
+	// Sorted by distance. A tier never allows more effects than a closer one, a tier that
+	// would is demoted to the significance of the closer tier. Characters beyond the last tier spawn no effects.
+	UPROPERTY(Config, EditAnywhere, Category = "Settings", Meta = (AllowPrivateAccess, TitleProperty = "Significance"))
+	TArray<FALSXTEffectsSignificanceTier> Tiers
+	{
+		{1500.0f, EALSXTEffectsSignificance::Full},
+		{4000.0f, EALSXTEffectsSignificance::SoundAndDecal},
+		{8000.0f, EALSXTEffectsSignificance::SoundOnly}
+	};
+
+	// Characters that were not rendered recently keep their sounds, but spawn no decals or particles.
+	UPROPERTY(Config, EditAnywhere, Category = "Settings", Meta = (AllowPrivateAccess))
+	bool bDemoteNotRenderedCharacters{true};
+
+	// Maximum number of effects spawned per frame. Zero means unlimited.
+	UPROPERTY(Config, EditAnywhere, Category = "Settings", Meta = (AllowPrivateAccess, ClampMin = 0))
+	int32 MaxEffectsPerFrame{16};
+
+	TArray<FVector, TInlineAllocator<4>> ViewerLocations;
+
+	uint64 ViewerLocationsFrame{0};
+
+	uint64 BudgetFrame{0};
+
+	int32 EffectsSpawnedThisFrame{0};
+
+public:
+	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+
+	UFUNCTION(BlueprintCallable, Category = "ALSXT|Effects Significance")
+	void SetTiers(const TArray<FALSXTEffectsSignificanceTier>& NewTiers);
+
+	UFUNCTION(BlueprintCallable, Category = "ALSXT|Effects Significance")
+	void SetMaxEffectsPerFrame(int32 NewMaxEffectsPerFrame);
+
+	UFUNCTION(BlueprintPure, Category = "ALSXT|Effects Significance")
+	int32 GetMaxEffectsPerFrame() const;
+
+	UFUNCTION(BlueprintPure, Category = "ALSXT|Effects Significance")
+	EALSXTEffectsSignificance EvaluateSignificance(const UPrimitiveComponent* Component);
+
+	// Returns false if there is no local viewer to measure against.
+	bool TryGetClosestViewerDistanceSquared(const FVector& Location, double& DistanceSquared);
+
+	// Returns false once this frame's effect budget is used up.
+	bool ConsumeEffectBudget();
+
+	// Worlds without this subsystem, such as animation editor previews, always get full effects.
+	static EALSXTEffectsSignificance GetSignificance(const UPrimitiveComponent* Component);
+
+	static bool ConsumeEffectBudget(UWorld* World);
+
+	static bool IsSoundAllowed(EALSXTEffectsSignificance Significance);
+
+	static bool IsDecalAllowed(EALSXTEffectsSignificance Significance);
+
+	static bool IsParticleSystemAllowed(EALSXTEffectsSignificance Significance);
+
+private:
+	void SortTiers();
+
+	void RefreshViewerLocations();
+};
+
+inline int32 UALSXTEffectsSignificanceSubsystem::GetMaxEffectsPerFrame() const
+{
+	return MaxEffectsPerFrame;
+}
+
+inline bool UALSXTEffectsSignificanceSubsystem::IsSoundAllowed(const EALSXTEffectsSignificance Significance)
+{
+	return Significance <= EALSXTEffectsSignificance::SoundOnly;
+}
+
+inline bool UALSXTEffectsSignificanceSubsystem::IsDecalAllowed(const EALSXTEffectsSignificance Significance)
+{
+	return Significance <= EALSXTEffectsSignificance::SoundAndDecal;
+}
+
+inline bool UALSXTEffectsSignificanceSubsystem::IsParticleSystemAllowed(const EALSXTEffectsSignificance Significance)
+{
+	return Significance == EALSXTEffectsSignificance::Full;
+}
@@ -0,0 +1,119 @@
+// MIT
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Engine/EngineTypes.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "UObject/ObjectKey.h"
+#include "WorldCollision.h"
+#include "State/ALSXTFootstepState.h"
+#include "ALSXTFootSurfaceProbeSubsystem.generated.h"
+
+class USceneComponent;
+
+DECLARE_DELEGATE_OneParam(FALSXTFootSurfaceProbeDelegate, const FHitResult& /*Hit*/);
+
+struct ALSXT_API FALSXTFootSurfaceProbeRequest
+{
+	TWeakObjectPtr<USceneComponent> Mesh;
+
+	EALSXTFootBone Foot{EALSXTFootBone::Left};
+
+	FVector Start{ForceInit};
+
+	FVector End{ForceInit};
+
+	ECollisionChannel TraceChannel{ECC_Visibility};
+
+	// The previous hit of this foot is reused while both ends of the trace moved less than this distance.
+	float ReuseDistance{0.0f};
+};
+
+struct ALSXT_API FALSXTFootSurfaceProbeKey
+{
+	TObjectKey<USceneComponent> Mesh;
+
+	EALSXTFootBone Foot{EALSXTFootBone::Left};
+
+	bool operator==(const FALSXTFootSurfaceProbeKey& Other) const
+	{
+		return Mesh == Other.Mesh && Foot == Other.Foot;
+	}
+
+	friend uint32 GetTypeHash(const FALSXTFootSurfaceProbeKey& Key)
+	{
+		return HashCombine(GetTypeHash(Key.Mesh), static_cast<uint32>(Key.Foot));
+	}
+};
+
+// Runs the foot surface traces of footstep and slide notifies as asynchronous scene queries that
+// complete on the next frame, and skips them entirely while a foot stays on the spot it last probed.
+UCLASS()
+class ALSXT_API UALSXTFootSurfaceProbeSubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+private:
+	struct FCachedProbe
+	{
+		FVector Start{ForceInit};
+
+		FVector End{ForceInit};
+
+		ECollisionChannel TraceChannel{ECC_Visibility};
+
+		FHitResult Hit;
+	};
+
+	struct FPendingProbe
+	{
+		FALSXTFootSurfaceProbeKey Key;
+
+		FVector Start{ForceInit};
+
+		FVector End{ForceInit};
+
+		ECollisionChannel TraceChannel{ECC_Visibility};
+
+		TArray<FALSXTFootSurfaceProbeDelegate, TInlineAllocator<2>> Callbacks;
+	};
+
+	FTraceDelegate ProbeCompletedDelegate;
+
+	TMap<FALSXTFootSurfaceProbeKey, FCachedProbe> CachedProbes;
+
+	TMap<FALSXTFootSurfaceProbeKey, uint32> PendingProbeIds;
+
+	TMap<uint32, FPendingProbe> PendingProbes;
+
+	uint32 NextProbeId{1};
+
+	int32 CompletedProbesSinceCleanup{0};
+
+public:
+	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+
+	virtual void Deinitialize() override;
+
+protected:
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+public:
+	// Calls the callback with the surface under the foot, either right away from the cached hit or on the next frame once
+	// the asynchronous trace has finished. Worlds without this subsystem fall back to a synchronous trace.
+	static void ProbeSurface(UWorld* World, const FALSXTFootSurfaceProbeRequest& Request, FALSXTFootSurfaceProbeDelegate&& Callback);
+
+	void RequestProbe(const FALSXTFootSurfaceProbeRequest& Request, FALSXTFootSurfaceProbeDelegate&& Callback);
+
+	void InvalidateProbes(const USceneComponent* Mesh);
+
+private:
+	static FCollisionQueryParams MakeQueryParameters(const FALSXTFootSurfaceProbeRequest& Request);
+
+	static void MakeMissHit(const FVector& Start, const FVector& End, FHitResult& Hit);
+
+	void OnProbeCompleted(const FTraceHandle& TraceHandle, FTraceDatum& TraceDatum);
+
+	void RemoveStaleProbes();
+};
@@ -0,0 +1,125 @@
+// MIT
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "ALSXTFootprintDecalSubsystem.generated.h"
+
+class UDecalComponent;
+class UMaterialInterface;
+class USceneComponent;
+
+UENUM(BlueprintType)
+enum class EALSXTFootprintDecalEvictionPolicy : uint8
+{
+	// Always reuse the oldest slot, even if its footprint is still visible.
+	RecycleOldest,
+	// Drop the new footprint while the oldest slot is still visible.
+	DiscardNewest
+};
+
+USTRUCT(BlueprintType)
+struct ALSXT_API FALSXTFootprintDecalPoolStats
+{
+	GENERATED_BODY()
+
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Stats")
+	int32 Capacity{0};
+
+	// Slots whose footprint has not finished fading out yet.
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Stats")
+	int32 ActiveDecals{0};
+
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Stats")
+	int32 ComponentsCreated{0};
+
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Stats")
+	int32 TotalAcquired{0};
+
+	// Footprints that were still visible when their slot got recycled.
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Stats")
+	int32 TotalEvicted{0};
+
+	// Footprints dropped because the pool was full (DiscardNewest only).
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Stats")
+	int32 TotalDiscarded{0};
+};
+
+// Per-world ring buffer of registered decal components used for footprints, so that
+// footsteps never create, register or garbage collect decal components at runtime.
+UCLASS(Config = Game)
+class ALSXT_API UALSXTFootprintDecalSubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+private:
+	UPROPERTY(Config, EditAnywhere, Category = "Settings", Meta = (AllowPrivateAccess, ClampMin = 1))
+	int32 Capacity{128};
+
+	UPROPERTY(Config, EditAnywhere, Category = "Settings", Meta = (AllowPrivateAccess))
+	EALSXTFootprintDecalEvictionPolicy EvictionPolicy{EALSXTFootprintDecalEvictionPolicy::RecycleOldest};
+
+	UPROPERTY(Transient)
+	TArray<TObjectPtr<UDecalComponent>> Decals;
+
+	// World time at which each slot was last handed out.
+	TArray<double> SlotAcquireTimes;
+
+	int32 NextSlotIndex{0};
+
+	FALSXTFootprintDecalPoolStats Stats;
+
+public:
+	virtual void OnWorldBeginPlay(UWorld& InWorld) override;
+
+	virtual void Deinitialize() override;
+
+protected:
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+public:
+	UFUNCTION(BlueprintCallable, Category = "ALSXT|Footprint Decal Pool")
+	void SetCapacity(int32 NewCapacity);
+
+	UFUNCTION(BlueprintPure, Category = "ALSXT|Footprint Decal Pool")
+	int32 GetCapacity() const;
+
+	UFUNCTION(BlueprintCallable, Category = "ALSXT|Footprint Decal Pool")
+	void SetEvictionPolicy(EALSXTFootprintDecalEvictionPolicy NewEvictionPolicy);
+
+	UFUNCTION(BlueprintPure, Category = "ALSXT|Footprint Decal Pool")
+	EALSXTFootprintDecalEvictionPolicy GetEvictionPolicy() const;
+
+	UFUNCTION(BlueprintPure, Category = "ALSXT|Footprint Decal Pool")
+	FALSXTFootprintDecalPoolStats GetStats() const;
+
+	// Moves the next slot of the ring to the given transform and returns it, or nullptr if
+	// the eviction policy refused to recycle a footprint that is still visible. Always nullptr on dedicated servers.
+	UDecalComponent* AcquireDecal(UMaterialInterface* Material, const FVector& Size, const FVector& Location,
+	                              const FRotator& Rotation, USceneComponent* AttachComponent = nullptr);
+
+	// Use instead of UDecalComponent::SetFadeOut() for pooled decals. The engine version
+	// destroys the component once the fade has finished.
+	void SetDecalFadeOut(UDecalComponent* Decal, float StartDelay, float Duration);
+
+	UFUNCTION(BlueprintCallable, Category = "ALSXT|Footprint Decal Pool")
+	void HideAllDecals();
+
+private:
+	void FillPool();
+
+	UDecalComponent* CreateDecal();
+
+	void DestroyDecals(int32 FirstIndex);
+};
+
+inline int32 UALSXTFootprintDecalSubsystem::GetCapacity() const
+{
+	return Capacity;
+}
+
+inline EALSXTFootprintDecalEvictionPolicy UALSXTFootprintDecalSubsystem::GetEvictionPolicy() const
+{
+	return EvictionPolicy;
+}
@@ -0,0 +1,132 @@
+// MIT
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "ALSXTImpactEffectPoolSubsystem.generated.h"
+
+class UFXSystemComponent;
+
+USTRUCT(BlueprintType)
+struct ALSXT_API FALSXTImpactEffectClassSettings
+{
+	GENERATED_BODY()
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Settings")
+	TSoftClassPtr<AActor> ActorClass;
+
+	// Actors spawned when the world begins play, so the first hits do not spawn any.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Settings", Meta = (ClampMin = 0))
+	int32 WarmUpCount{4};
+
+	// Once this many actors of the class are playing, the oldest one is recycled.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Settings", Meta = (ClampMin = 1))
+	int32 MaxSize{16};
+
+	// Effects return to the pool once all their particle systems have finished, or after this time at the latest.
+	// Zero means no limit, so effects without particle systems only return when they are recycled.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Settings", Meta = (ClampMin = 0, ForceUnits = "s"))
+	float MaxLifetime{5.0f};
+};
+
+USTRUCT(BlueprintType)
+struct ALSXT_API FALSXTImpactEffectPoolStats
+{
+	GENERATED_BODY()
+
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Stats")
+	int32 ActiveEffects{0};
+
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Stats")
+	int32 ActorsSpawned{0};
+
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Stats")
+	int32 TotalAcquired{0};
+
+	// Effects that were still playing when their actor got recycled.
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Stats")
+	int32 TotalRecycled{0};
+};
+
+// Per-world pools of impact effect actors keyed by class, so that hits never spawn or destroy actors once
+// a class has reached its pool size. Pooled actors are hidden and their particle systems deactivated
+// between uses, and return to the pool on their own once their particle systems have finished. BeginPlay
+// only runs once per actor, effects that need more than their particle systems restarted implement
+// IALSXTPooledEffectInterface.
+UCLASS(Config = Game)
+class ALSXT_API UALSXTImpactEffectPoolSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+private:
+	UPROPERTY(Config, EditAnywhere, Category = "Settings", Meta = (AllowPrivateAccess, TitleProperty = "ActorClass"))
+	TArray<FALSXTImpactEffectClassSettings> ClassSettings;
+
+	// Used for classes that are not listed in the class settings. Their warm up count is ignored.
+	UPROPERTY(Config, EditAnywhere, Category = "Settings", Meta = (AllowPrivateAccess))
+	FALSXTImpactEffectClassSettings DefaultClassSettings{{}, 0, 8};
+
+	struct FPooledEffect
+	{
+		TWeakObjectPtr<AActor> Actor;
+
+		TArray<TWeakObjectPtr<UFXSystemComponent>, TInlineAllocator<2>> ParticleSystems;
+
+		double AcquireTime{0.0};
+
+		uint64 AcquireFrame{0};
+
+		bool bCollisionEnabled{true};
+
+		bool bActive{false};
+	};
+
+	struct FClassPool
+	{
+		TArray<FPooledEffect> Effects;
+
+		int32 MaxSize{1};
+
+		float MaxLifetime{0.0f};
+
+		int32 ActiveEffects{0};
+	};
+
+	TMap<TObjectKey<UClass>, FClassPool> Pools;
+
+	int32 ActiveEffects{0};
+
+	FALSXTImpactEffectPoolStats Stats;
+
+public:
+	virtual void OnWorldBeginPlay(UWorld& InWorld) override;
+
+	virtual void Deinitialize() override;
+
+	virtual void Tick(float DeltaTime) override;
+
+	virtual TStatId GetStatId() const override;
+
+	virtual bool IsTickable() const override;
+
+	UFUNCTION(BlueprintPure, Category = "ALSXT|Impact Effect Pool")
+	FALSXTImpactEffectPoolStats GetStats() const;
+
+	// Moves a pooled actor of the class to the transform, restarts its particle systems and notifies it through
+	// IALSXTPooledEffectInterface.
+	UFUNCTION(BlueprintCallable, Category = "ALSXT|Impact Effect Pool")
+	AActor* AcquireEffect(TSubclassOf<AActor> ActorClass, const FTransform& Transform);
+
+	UFUNCTION(BlueprintCallable, Category = "ALSXT|Impact Effect Pool")
+	void ReleaseAllEffects();
+
+private:
+	FClassPool& FindOrAddPool(UClass* ActorClass);
+
+	bool SpawnEffect(UClass* ActorClass, FClassPool& Pool);
+
+	void ActivateEffect(FPooledEffect& Effect, FClassPool& Pool, const FTransform& Transform);
+
+	void DeactivateEffect(FPooledEffect& Effect, FClassPool& Pool);
+};
@@ -0,0 +1,88 @@
+// MIT
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "UObject/ObjectKey.h"
+#include "ALSXTTargetRegistrySubsystem.generated.h"
+
+class ULevel;
+
+// All actors implementing the target lock interface, bucketed into a uniform grid on the XY plane, so that
+// target acquisition only looks at nearby cells instead of sweeping the physics scene. Actors are registered
+// automatically when they are spawned or their level is added to the world. Locations are refreshed at most
+// once per frame, on the first query.
+UCLASS(Config = Game)
+class ALSXT_API UALSXTTargetRegistrySubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+private:
+	// Should be about the usual target lock distance, so that a query touches no more than 3x3 cells.
+	UPROPERTY(Config, EditAnywhere, Category = "Settings", Meta = (AllowPrivateAccess, ClampMin = 100, ForceUnits = "cm"))
+	float CellSize{1000.0f};
+
+	struct FTarget
+	{
+		TWeakObjectPtr<AActor> Actor;
+
+		// Still identifies the actor after it has been destroyed.
+		TObjectKey<AActor> Key;
+
+		FVector Location{ForceInit};
+
+		FIntPoint Cell{ForceInit};
+	};
+
+	TArray<FTarget> Targets;
+
+	TMap<TObjectKey<AActor>, int32> TargetIndices;
+
+	TMap<FIntPoint, TArray<int32, TInlineAllocator<8>>> Cells;
+
+	uint64 RefreshFrame{0};
+
+	FDelegateHandle ActorSpawnedHandle;
+
+	FDelegateHandle LevelAddedHandle;
+
+public:
+	virtual void OnWorldBeginPlay(UWorld& InWorld) override;
+
+	virtual void Deinitialize() override;
+
+	UFUNCTION(BlueprintCallable, Category = "ALSXT|Target Registry")
+	void RegisterTarget(AActor* Actor);
+
+	UFUNCTION(BlueprintCallable, Category = "ALSXT|Target Registry")
+	void UnregisterTarget(AActor* Actor);
+
+	UFUNCTION(BlueprintPure, Category = "ALSXT|Target Registry")
+	int32 GetNumTargets() const;
+
+	// Appends all registered targets within the radius of the location. Both arrays get the same number of entries.
+	void QueryTargets(const FVector& Location, float Radius, TArray<AActor*>& OutActors, TArray<FVector>& OutLocations);
+
+private:
+	void OnActorSpawned(AActor* Actor);
+
+	void OnLevelAdded(ULevel* Level, UWorld* World);
+
+	void RegisterLevelTargets(const ULevel* Level);
+
+	void RefreshTargets();
+
+	void RemoveTargetAt(int32 TargetIndex);
+
+	void AddToCell(const FIntPoint& Cell, int32 TargetIndex);
+
+	void RemoveFromCell(const FIntPoint& Cell, int32 TargetIndex);
+
+	FIntPoint GetCell(const FVector& Location) const;
+};
+
+inline int32 UALSXTTargetRegistrySubsystem::GetNumTargets() const
+{
+	return Targets.Num();
+}
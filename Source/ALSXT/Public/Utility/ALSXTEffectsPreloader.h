@@ -0,0 +1,81 @@
+// MIT
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Engine/StreamableManager.h"
+#include "Engine/World.h"
+#include "ALSXTEffectsPreloader.generated.h"
+
+UENUM(BlueprintType)
+enum class EALSXTEffectsPreloadStatus : uint8
+{
+	NotRequested,
+	Loading,
+	Loaded,
+	// Loading finished, but some assets could not be loaded.
+	Incomplete
+};
+
+USTRUCT(BlueprintType)
+struct ALSXT_API FALSXTEffectsPreloadInfo
+{
+	GENERATED_BODY()
+
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Preload")
+	EALSXTEffectsPreloadStatus Status{EALSXTEffectsPreloadStatus::NotRequested};
+
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Preload")
+	int32 NumAssets{0};
+
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Preload")
+	int32 NumLoadedAssets{0};
+
+	// Estimated total resource size of the loaded assets.
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Preload", Meta = (ForceUnits = "Bytes"))
+	int64 MemoryBytes{0};
+};
+
+// Keeps the soft referenced assets of an effects settings asset loaded through the streamable manager.
+struct ALSXT_API FALSXTEffectsPreloader
+{
+private:
+	TArray<FSoftObjectPath> AssetPaths;
+
+	TSharedPtr<FStreamableHandle> Handle;
+
+	bool bRequested{false};
+
+public:
+	bool IsRequested() const;
+
+	// Starts loading the given assets asynchronously. Does nothing if the same assets are already requested.
+	void Request(TArray<FSoftObjectPath>&& NewAssetPaths, const FString& DebugName);
+
+	void Release();
+
+	FALSXTEffectsPreloadInfo GetInfo() const;
+
+	// Returns the asset if it is already loaded. Editor preview worlds load it synchronously instead,
+	// all other worlds skip the effect until the preload has finished rather than hitching.
+	template <typename AssetType>
+	static AssetType* GetLoadedAsset(const TSoftObjectPtr<AssetType>& Asset, const UWorld* World);
+};
+
+inline bool FALSXTEffectsPreloader::IsRequested() const
+{
+	return bRequested;
+}
+
+template <typename AssetType>
+AssetType* FALSXTEffectsPreloader::GetLoadedAsset(const TSoftObjectPtr<AssetType>& Asset, const UWorld* World)
+{
+	auto* LoadedAsset{Asset.Get()};
+
+	if (LoadedAsset == nullptr && !Asset.IsNull() && IsValid(World) && World->WorldType == EWorldType::EditorPreview)
+	{
+		LoadedAsset = Asset.LoadSynchronous();
+	}
+
+	return LoadedAsset;
+}
@@ -0,0 +1,133 @@
+// MIT
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Chaos/ChaosEngineInterface.h"
+#include "State/ALSXTFootstepState.h"
+#include "ALSXTFootprintMaterialCache.generated.h"
+
+class UMaterialInstanceDynamic;
+class UMaterialInterface;
+class UTexture;
+
+enum class EALSXTFootprintTextureParameter : uint8
+{
+	SoleTexture,
+	SoleNormal,
+	SoleDetail,
+	TransferDetailTexture,
+	TransferDetailNormal,
+	TransferDetailTexturePrevious,
+	TransferDetailNormalPrevious,
+	Count
+};
+
+enum class EALSXTFootprintScalarParameter : uint8
+{
+	SoleNormalScale,
+	TransferNormalScale,
+	TransferDetailScale,
+	Opacity,
+	GrainSize,
+	Wetness,
+	EmissiveAmount,
+	TransferNormalScalePrevious,
+	TransferDetailScalePrevious,
+	GrainSizePrevious,
+	WetnessPrevious,
+	EmissiveAmountPrevious,
+	PhaseAlpha,
+	TransferAmount,
+	SurfaceTransferAmount,
+	TransferAmountPrevious,
+	SurfaceTransferAmountPrevious,
+	Count
+};
+
+enum class EALSXTFootprintVectorParameter : uint8
+{
+	PrimaryColor,
+	SecondaryColor,
+	PrimaryColorPrevious,
+	SecondaryColorPrevious,
+	Count
+};
+
+// Values of every footprint decal material parameter for a single footstep.
+struct ALSXT_API FALSXTFootprintMaterialParameters
+{
+	UTexture* Textures[static_cast<uint8>(EALSXTFootprintTextureParameter::Count)]{};
+
+	float Scalars[static_cast<uint8>(EALSXTFootprintScalarParameter::Count)]{};
+
+	FLinearColor Vectors[static_cast<uint8>(EALSXTFootprintVectorParameter::Count)]{};
+
+	void SetTexture(EALSXTFootprintTextureParameter Parameter, UTexture* Value);
+
+	void SetScalar(EALSXTFootprintScalarParameter Parameter, float Value);
+
+	void SetVector(EALSXTFootprintVectorParameter Parameter, const FLinearColor& Value);
+};
+
+USTRUCT()
+struct ALSXT_API FALSXTFootprintMaterialCacheEntry
+{
+	GENERATED_BODY()
+
+	UPROPERTY(Transient)
+	TObjectPtr<UMaterialInstanceDynamic> Material;
+
+	UPROPERTY(Transient)
+	TObjectPtr<UMaterialInterface> ParentMaterial;
+
+	EALSXTFootBone Foot{EALSXTFootBone::Left};
+
+	TEnumAsByte<EPhysicalSurface> SurfaceType{SurfaceType_Default};
+
+	// Indices returned by UMaterialInstanceDynamic::Initialize*ParameterAndGetIndex(), INDEX_NONE until first use.
+	int32 ScalarIndices[static_cast<uint8>(EALSXTFootprintScalarParameter::Count)];
+
+	int32 VectorIndices[static_cast<uint8>(EALSXTFootprintVectorParameter::Count)];
+
+	// Last values pushed to the material, only used to skip redundant updates. The material keeps the textures alive.
+	FALSXTFootprintMaterialParameters Values;
+
+	FALSXTFootprintMaterialCacheEntry();
+};
+
+// Footprint decal materials of a single character, one per foot and surface, so that steady
+// walking reuses the same material instance and only pushes the parameters that changed.
+USTRUCT()
+struct ALSXT_API FALSXTFootprintMaterialCache
+{
+	GENERATED_BODY()
+
+private:
+	UPROPERTY(Transient)
+	TArray<FALSXTFootprintMaterialCacheEntry> Entries;
+
+public:
+	UMaterialInstanceDynamic* GetMaterial(UObject* Outer, UMaterialInterface* ParentMaterial, EALSXTFootBone Foot,
+	                                      EPhysicalSurface SurfaceType, const FALSXTFootprintMaterialParameters& Parameters);
+
+	void Reset();
+
+private:
+	static void ApplyParameters(FALSXTFootprintMaterialCacheEntry& Entry, const FALSXTFootprintMaterialParameters& Parameters, bool bForce);
+};
+
+inline void FALSXTFootprintMaterialParameters::SetTexture(const EALSXTFootprintTextureParameter Parameter, UTexture* Value)
+{
+	Textures[static_cast<uint8>(Parameter)] = Value;
+}
+
+inline void FALSXTFootprintMaterialParameters::SetScalar(const EALSXTFootprintScalarParameter Parameter, const float Value)
+{
+	Scalars[static_cast<uint8>(Parameter)] = Value;
+}
+
+inline void FALSXTFootprintMaterialParameters::SetVector(const EALSXTFootprintVectorParameter Parameter, const FLinearColor& Value)
+{
+	Vectors[static_cast<uint8>(Parameter)] = Value;
+}
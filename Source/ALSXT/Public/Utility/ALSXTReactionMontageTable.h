@@ -0,0 +1,113 @@
+// MIT
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Utility/ALSXTStructs.h"
+
+struct FRandomStream;
+
+struct ALSXT_API FALSXTReactionKey
+{
+	FGameplayTag Location;
+
+	FGameplayTag Strength;
+
+	FGameplayTag Side;
+
+	FGameplayTag Form;
+
+	bool operator==(const FALSXTReactionKey& Other) const
+	{
+		return Location == Other.Location && Strength == Other.Strength && Side == Other.Side && Form == Other.Form;
+	}
+
+	friend uint32 GetTypeHash(const FALSXTReactionKey& Key)
+	{
+		return HashCombine(HashCombine(GetTypeHash(Key.Location), GetTypeHash(Key.Strength)),
+		                   HashCombine(GetTypeHash(Key.Side), GetTypeHash(Key.Form)));
+	}
+};
+
+// The last few reaction montages played by a character. Only used for comparison, the pointers are never dereferenced.
+struct ALSXT_API FALSXTReactionHistory
+{
+	static constexpr int32 Capacity{4};
+
+private:
+	const UAnimMontage* Montages[Capacity]{};
+
+	int32 NextIndex{0};
+
+public:
+	void Add(const UAnimMontage* Montage);
+
+	void Reset();
+
+	// 0 is the most recent reaction.
+	const UAnimMontage* GetRecent(int32 Age) const;
+};
+
+// Reaction montages of a settings asset keyed by impact location, strength, side and form. The montages are
+// copied out of the source arrays, so the table must be compiled again whenever they change, but an outdated table
+// never points into freed memory. Reactions are stored in the order of the source arrays, so tables compiled from
+// the same asset share their indices.
+struct ALSXT_API FALSXTReactionMontageTable
+{
+private:
+	struct FEntry
+	{
+		int32 FirstRegularMontage{0};
+
+		int32 NumRegularMontages{0};
+
+		int32 FirstBlockingMontage{0};
+
+		int32 NumBlockingMontages{0};
+
+		TWeakObjectPtr<UAnimMontage> FallbackMontage;
+	};
+
+	// Regular and blocking montages of all reactions, with the montages of each reaction next to each other. Weak,
+	// since the table is not seen by the garbage collector.
+	TArray<TWeakObjectPtr<UAnimMontage>> Montages;
+
+	TArray<FEntry> Entries;
+
+	TMap<FALSXTReactionKey, int32> EntryIndices;
+
+	bool bCompiled{false};
+
+public:
+	bool IsCompiled() const;
+
+	int32 Num() const;
+
+	void Compile(const TArray<FImpactReactionLocation>& Locations);
+
+	// Returns INDEX_NONE if the table has no such reaction.
+	int32 FindReaction(const FALSXTReactionKey& Key) const;
+
+	// Picks a random montage that is not in the history, unless every montage of the reaction is, and adds it to the
+	// history. Falls back to the default montage of the reaction if it has no montages.
+	UAnimMontage* SelectMontage(const FALSXTReactionKey& Key, bool bBlocking, FRandomStream& RandomStream,
+	                            FALSXTReactionHistory& History) const;
+
+	// Same as SelectMontage(), but returns the index of the montage among the regular or blocking montages of the
+	// reaction, so that the pick can be sent to other machines. Returns INDEX_NONE if the reaction has no montages.
+	int32 SelectMontageIndex(int32 ReactionIndex, bool bBlocking, FRandomStream& RandomStream,
+	                         FALSXTReactionHistory& History) const;
+
+	// Montage indices out of range, including INDEX_NONE, give the fallback montage of the reaction.
+	UAnimMontage* GetMontage(int32 ReactionIndex, bool bBlocking, int32 MontageIndex) const;
+};
+
+inline bool FALSXTReactionMontageTable::IsCompiled() const
+{
+	return bCompiled;
+}
+
+inline int32 FALSXTReactionMontageTable::Num() const
+{
+	return Entries.Num();
+}
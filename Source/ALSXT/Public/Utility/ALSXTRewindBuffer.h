@@ -0,0 +1,78 @@
+// MIT
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Containers/StaticArray.h"
+
+struct ALSXT_API FALSXTRewindSample
+{
+	static constexpr int32 MaxBones{8};
+
+	double Time{0.0};
+
+	FVector CapsuleLocation{ForceInit};
+
+	FQuat CapsuleRotation{ForceInit};
+
+	float CapsuleRadius{0.0f};
+
+	float CapsuleHalfHeight{0.0f};
+
+	// Component space is not enough for validation, so the bones are stored in world space.
+	TStaticArray<FVector, MaxBones> BoneLocations;
+};
+
+// Fixed-size ring of recent character poses. The server uses it to check a claimed hit against
+// the pose the attacker saw, instead of trusting the client or simulating the attack again.
+struct ALSXT_API FALSXTRewindBuffer
+{
+private:
+	TArray<FALSXTRewindSample> Samples;
+
+	TArray<FName, TInlineAllocator<FALSXTRewindSample::MaxBones>> BoneNames;
+
+	int32 NextSampleIndex{0};
+
+	int32 NumSamples{0};
+
+public:
+	// Allocates the whole ring up front. Bones beyond FALSXTRewindSample::MaxBones are ignored.
+	void Initialize(int32 Capacity, const TArray<FName>& NewBoneNames);
+
+	void Reset();
+
+	bool IsInitialized() const;
+
+	int32 GetNumBones() const;
+
+	const FName& GetBoneName(int32 BoneIndex) const;
+
+	int32 FindBoneIndex(const FName& BoneName) const;
+
+	// Returns the slot of the oldest sample, to be filled in by the caller.
+	FALSXTRewindSample& AddSample(double Time);
+
+	// Interpolates between the two samples around the given time. Times outside of the recorded range are clamped.
+	bool GetSampleAtTime(double Time, FALSXTRewindSample& Sample) const;
+};
+
+inline bool FALSXTRewindBuffer::IsInitialized() const
+{
+	return Samples.Num() > 0;
+}
+
+inline int32 FALSXTRewindBuffer::GetNumBones() const
+{
+	return BoneNames.Num();
+}
+
+inline const FName& FALSXTRewindBuffer::GetBoneName(const int32 BoneIndex) const
+{
+	return BoneNames[BoneIndex];
+}
+
+inline int32 FALSXTRewindBuffer::FindBoneIndex(const FName& BoneName) const
+{
+	return BoneNames.IndexOfByKey(BoneName);
+}
@@ -0,0 +1,65 @@
+// MIT
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GameplayTagContainer.h"
+
+// Character sounds filtered by two tag lists per sound, such as strength and stamina. Each list is compiled into a
+// bitmask over the few distinct tags used by the sound array, so filtering is a bitwise test per sound. Indices match
+// the source array, which must be compiled again whenever it changes.
+struct ALSXT_API FALSXTSoundTagTable
+{
+	static constexpr int32 MaxTags{64};
+
+private:
+	TArray<FGameplayTag, TInlineAllocator<8>> FirstTags;
+
+	TArray<FGameplayTag, TInlineAllocator<8>> SecondTags;
+
+	TArray<uint64> FirstTagMasks;
+
+	TArray<uint64> SecondTagMasks;
+
+	bool bCompiled{false};
+
+public:
+	bool IsCompiled() const;
+
+	template <typename SoundType>
+	void Compile(const TArray<SoundType>& Sounds, TArray<FGameplayTag> SoundType::* FirstTagsMember,
+	             TArray<FGameplayTag> SoundType::* SecondTagsMember);
+
+	// Picks a random sound that has both tags and is not the previous one, unless it is the only match. An empty
+	// tag matches any sound. Returns INDEX_NONE if no sound matches.
+	int32 SelectSoundIndex(const FGameplayTag& FirstTag, const FGameplayTag& SecondTag, int32 PreviousIndex = INDEX_NONE) const;
+
+private:
+	static uint64 CompileTagMask(TArray<FGameplayTag, TInlineAllocator<8>>& Vocabulary, const TArray<FGameplayTag>& Tags);
+
+	static uint64 GetTagMask(const TArray<FGameplayTag, TInlineAllocator<8>>& Vocabulary, const FGameplayTag& Tag);
+};
+
+inline bool FALSXTSoundTagTable::IsCompiled() const
+{
+	return bCompiled;
+}
+
+template <typename SoundType>
+void FALSXTSoundTagTable::Compile(const TArray<SoundType>& Sounds, TArray<FGameplayTag> SoundType::* FirstTagsMember,
+                                  TArray<FGameplayTag> SoundType::* SecondTagsMember)
+{
+	FirstTags.Reset();
+	SecondTags.Reset();
+
+	FirstTagMasks.Reset(Sounds.Num());
+	SecondTagMasks.Reset(Sounds.Num());
+
+	for (const auto& Sound : Sounds)
+	{
+		FirstTagMasks.Add(CompileTagMask(FirstTags, Sound.*FirstTagsMember));
+		SecondTagMasks.Add(CompileTagMask(SecondTags, Sound.*SecondTagsMember));
+	}
+
+	bCompiled = true;
+}
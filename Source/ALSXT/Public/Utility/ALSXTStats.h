@@ -0,0 +1,7 @@
+// MIT
+
+#pragma once
+
+#include "Stats/Stats.h"
+
+DECLARE_STATS_GROUP(TEXT("ALSXT"), STATGROUP_ALSXT, STATCAT_Advanced);
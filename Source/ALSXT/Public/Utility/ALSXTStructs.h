@@ -129,6 +129,18 @@ struct ALSXT_API FExtendedHitResult
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Meta = (AllowPrivateAccess))
 	FHitResult HitResult;
 
+	// Only replicates the hit result fields that reactions use. The bone is sent as an index into the hit
+	// skinned mesh, locations and normals are quantized.
+	bool NetSerialize(FArchive& Archive, UPackageMap* Map, bool& bSuccess);
+};
+
+template <>
+struct TStructOpsTypeTraits<FExtendedHitResult> : public TStructOpsTypeTraitsBase2<FExtendedHitResult>
+{
+	enum
+	{
+		WithNetSerializer = true
+	};
 };
 
 USTRUCT(BlueprintType)
@@ -160,6 +172,16 @@ struct ALSXT_API FDoubleHitResult
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Meta = (AllowPrivateAccess))
 	FExtendedHitResult OriginHitResult;
 
+	bool NetSerialize(FArchive& Archive, UPackageMap* Map, bool& bSuccess);
+};
+
+template <>
+struct TStructOpsTypeTraits<FDoubleHitResult> : public TStructOpsTypeTraitsBase2<FDoubleHitResult>
+{
+	enum
+	{
+		WithNetSerializer = true
+	};
 };
 
 USTRUCT(BlueprintType)
@@ -182,6 +204,45 @@ struct ALSXT_API FAttackDoubleHitResult
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Meta = (AllowPrivateAccess))
 	FDoubleHitResult DoubleHitResult;
 
+	bool NetSerialize(FArchive& Archive, UPackageMap* Map, bool& bSuccess);
+};
+
+template <>
+struct TStructOpsTypeTraits<FAttackDoubleHitResult> : public TStructOpsTypeTraitsBase2<FAttackDoubleHitResult>
+{
+	enum
+	{
+		WithNetSerializer = true
+	};
+};
+
+// What the attacking client saw when it registered a hit, checked by the server against its rewind buffers.
+USTRUCT(BlueprintType)
+struct ALSXT_API FALSXTAttackHitClaim
+{
+	GENERATED_BODY()
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Meta = (AllowPrivateAccess))
+	TObjectPtr<AActor> Victim;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Meta = (AllowPrivateAccess))
+	FVector_NetQuantize TraceStart;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Meta = (AllowPrivateAccess))
+	FVector_NetQuantize TraceEnd;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Meta = (AllowPrivateAccess))
+	float TraceRadius{ 0.0f };
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Meta = (AllowPrivateAccess))
+	FName BoneName;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Meta = (AllowPrivateAccess))
+	FVector_NetQuantize Location;
+
+	// Server world time of the victim pose the attacking client saw.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Meta = (AllowPrivateAccess))
+	double Time{ 0.0 };
 };
 
 USTRUCT(BlueprintType)
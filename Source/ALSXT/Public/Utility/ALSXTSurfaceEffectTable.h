@@ -0,0 +1,73 @@
+// MIT
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Chaos/ChaosEngineInterface.h"
+
+// Dense lookup table built from a surface type keyed effects map. Surfaces without their own entry
+// resolve to the fallback entry: SurfaceType_Default if present, otherwise the lowest surface type.
+// The table points into the map, so it must be compiled again whenever the map changes.
+template <typename EffectSettingsType>
+struct TALSXTSurfaceEffectTable
+{
+private:
+	const EffectSettingsType* Effects[SurfaceType_Max]{};
+
+	bool bCompiled{false};
+
+public:
+	bool IsCompiled() const
+	{
+		return bCompiled;
+	}
+
+	void Compile(const TMap<TEnumAsByte<EPhysicalSurface>, EffectSettingsType>& SourceEffects)
+	{
+		const EffectSettingsType* FallbackEffect{nullptr};
+		auto FallbackSurfaceType{static_cast<int32>(SurfaceType_Max)};
+
+		for (auto& Effect : Effects)
+		{
+			Effect = nullptr;
+		}
+
+		for (const auto& Pair : SourceEffects)
+		{
+			const auto SurfaceType{static_cast<int32>(Pair.Key.GetValue())};
+
+			if (SurfaceType >= SurfaceType_Max)
+			{
+				continue;
+			}
+
+			Effects[SurfaceType] = &Pair.Value;
+
+			if (SurfaceType < FallbackSurfaceType)
+			{
+				FallbackSurfaceType = SurfaceType;
+				FallbackEffect = &Pair.Value;
+			}
+		}
+
+		for (auto& Effect : Effects)
+		{
+			if (Effect == nullptr)
+			{
+				Effect = FallbackEffect;
+			}
+		}
+
+		bCompiled = true;
+	}
+
+	void Invalidate()
+	{
+		bCompiled = false;
+	}
+
+	const EffectSettingsType* Find(const EPhysicalSurface SurfaceType) const
+	{
+		return SurfaceType < SurfaceType_Max ? Effects[SurfaceType] : Effects[SurfaceType_Default];
+	}
+};